@@ -0,0 +1,122 @@
+#include "bench.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+
+// --- 分配计数：替换全局 operator new/delete ---
+
+namespace {
+std::atomic<std::uint64_t> g_allocations = 0;
+
+void* counted_alloc(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (size == 0) size = 1;
+    if (void* ptr = std::malloc(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* counted_aligned_alloc(std::size_t size, std::align_val_t alignment) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    const auto align = static_cast<std::size_t>(alignment);
+    size = (std::max<std::size_t>(size, 1) + align - 1) / align * align;   // aligned_alloc 要求大小是对齐的整数倍
+    if (void* ptr = std::aligned_alloc(align, size)) return ptr;
+    throw std::bad_alloc();
+}
+} // namespace
+
+void* operator new(std::size_t size) { return counted_alloc(size); }
+void* operator new[](std::size_t size) { return counted_alloc(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try { return counted_alloc(size); } catch (...) { return nullptr; }
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try { return counted_alloc(size); } catch (...) { return nullptr; }
+}
+void* operator new(std::size_t size, std::align_val_t alignment) { return counted_aligned_alloc(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return counted_aligned_alloc(size, alignment); }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+
+namespace bench {
+namespace {
+constexpr std::size_t SAMPLE_COUNT = 5;     // 每个基准的采样次数（取中位数）
+std::size_t g_failed_checks = 0;
+
+double elapsed_ns(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+} // namespace
+
+std::uint64_t allocation_count() {
+    return g_allocations.load(std::memory_order_relaxed);
+}
+
+void check(bool condition, std::string_view description) {
+    if (condition) {
+        spdlog::info("检查通过：{}", description);
+        return;
+    }
+    spdlog::error("检查失败：{}", description);
+    ++g_failed_checks;
+}
+
+std::size_t failed_check_count() {
+    return g_failed_checks;
+}
+
+void Registry::add(std::string name, Body body) {
+    entries_.push_back(Entry{std::move(name), std::move(body)});
+}
+
+std::vector<Result> Registry::run(std::string_view filter, double min_time_ms) const {
+    std::vector<Result> results;
+    const double min_time_ns = min_time_ms * 1.0e6;
+
+    for (const auto& entry : entries_) {
+        if (!filter.empty() && entry.name.find(filter) == std::string::npos) continue;
+
+        // 预热并校准迭代次数：翻倍直到单次采样耗时达到 min_time
+        std::uint64_t iterations = 1;
+        while (true) {
+            const auto start = std::chrono::steady_clock::now();
+            entry.body(iterations);
+            const double ns = elapsed_ns(start);
+            if (ns >= min_time_ns || iterations >= (1ull << 40)) break;
+            // 按比例估算，避免极慢的基准翻倍过多次
+            const double scale = ns > 0.0 ? std::clamp(min_time_ns / ns * 1.2, 2.0, 100.0) : 100.0;
+            iterations = static_cast<std::uint64_t>(static_cast<double>(iterations) * scale);
+        }
+
+        std::array<double, SAMPLE_COUNT> samples{};
+        std::uint64_t allocations = 0;
+        for (auto& sample : samples) {
+            const std::uint64_t allocs_before = allocation_count();
+            const auto start = std::chrono::steady_clock::now();
+            entry.body(iterations);
+            sample = elapsed_ns(start) / static_cast<double>(iterations);
+            allocations += allocation_count() - allocs_before;
+        }
+        std::sort(samples.begin(), samples.end());
+
+        Result result{entry.name
+                    , samples[SAMPLE_COUNT / 2]
+                    , static_cast<double>(allocations) / static_cast<double>(iterations * SAMPLE_COUNT)
+                    , iterations};
+        spdlog::info("{:<48} {:>12.1f} ns/op {:>8.2f} allocs/op  ({} iterations)",
+                     result.name, result.ns_per_op, result.allocs_per_op, result.iterations);
+        results.push_back(std::move(result));
+    }
+    return results;
+}
+} // namespace bench
@@ -0,0 +1,69 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace bench {
+/**
+ * @brief 单个基准测试的结果
+ */
+struct Result {
+    std::string name;                   ///< @brief 基准名称
+    double ns_per_op = 0.0;             ///< @brief 每次操作的耗时（纳秒，多次采样的中位数）
+    double allocs_per_op = 0.0;         ///< @brief 每次操作的堆分配次数
+    std::uint64_t iterations = 0;       ///< @brief 每次采样的迭代次数
+};
+
+/**
+ * @brief 基准函数：执行 iterations 次被测操作
+ * @note 循环放在函数内部，避免 std::function 的调用开销计入每次操作
+ */
+using Body = std::function<void(std::uint64_t iterations)>;
+
+/**
+ * @brief 基准注册表与运行器
+ */
+class Registry final {
+public:
+    /// @brief 注册一个基准（名称约定为 "被测函数/规模"）
+    void add(std::string name, Body body);
+
+    /**
+     * @brief 运行名称包含 filter 的所有基准
+     * @param filter 名称过滤（空表示全部）
+     * @param min_time_ms 每次采样的最短时间
+     */
+    std::vector<Result> run(std::string_view filter, double min_time_ms) const;
+
+private:
+    struct Entry {
+        std::string name;
+        Body body;
+    };
+    std::vector<Entry> entries_;
+};
+
+/// @brief 进程启动以来的堆分配次数（由替换的全局 operator new 统计）
+std::uint64_t allocation_count();
+
+/**
+ * @brief 正确性检查（在注册基准时执行）：条件不成立时输出错误并计入失败次数
+ * @note 以 --check 运行时只执行检查，有检查失败时返回非 0（ctest 使用）
+ */
+void check(bool condition, std::string_view description);
+
+/// @brief 失败的检查数
+std::size_t failed_check_count();
+
+/// @brief 阻止编译器把结果优化掉
+template <typename T>
+inline void do_not_optimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/// @brief 注册引擎热点路径的基准
+void register_engine_benchmarks(Registry& registry);
+} // namespace bench
@@ -0,0 +1,127 @@
+#include "bench.hpp"
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+#include <fstream>
+#include <map>
+#include <string>
+#include <string_view>
+
+namespace {
+bool write_json(const std::vector<bench::Result>& results, const std::string& path) {
+    nlohmann::json json;
+    json["benchmarks"] = nlohmann::json::array();
+    for (const auto& result : results) {
+        json["benchmarks"].push_back({
+            {"name", result.name},
+            {"ns_per_op", result.ns_per_op},
+            {"allocs_per_op", result.allocs_per_op},
+            {"iterations", result.iterations}
+        });
+    }
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        spdlog::error("无法写入基准结果文件 '{}'", path);
+        return false;
+    }
+    file << json.dump(4);
+    spdlog::info("基准结果已写入 '{}'", path);
+    return true;
+}
+
+bool read_json(const std::string& path, std::map<std::string, bench::Result>& results) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        spdlog::error("无法打开基准结果文件 '{}'", path);
+        return false;
+    }
+    try {
+        const auto json = nlohmann::json::parse(file);
+        for (const auto& item : json.at("benchmarks")) {
+            bench::Result result{item.at("name").get<std::string>()
+                               , item.at("ns_per_op").get<double>()
+                               , item.at("allocs_per_op").get<double>()
+                               , item.value("iterations", std::uint64_t{0})};
+            results[result.name] = std::move(result);
+        }
+    } catch (const std::exception& e) {
+        spdlog::error("解析基准结果文件 '{}' 失败: {}", path, e.what());
+        return false;
+    }
+    return true;
+}
+
+/// @brief 对比两次构建的结果，打印每个基准的耗时与分配次数变化（负数表示变快/变少）
+int compare(const std::string& base_path, const std::string& new_path) {
+    std::map<std::string, bench::Result> base_results;
+    std::map<std::string, bench::Result> new_results;
+    if (!read_json(base_path, base_results) || !read_json(new_path, new_results)) return 1;
+
+    spdlog::info("{:<48} {:>12} {:>12} {:>9} {:>10} {:>10}", "benchmark", "base ns/op", "new ns/op", "delta", "base alloc", "new alloc");
+    for (const auto& [name, base] : base_results) {
+        auto it = new_results.find(name);
+        if (it == new_results.end()) {
+            spdlog::info("{:<48} {:>12.1f} {:>12} ", name, base.ns_per_op, "(missing)");
+            continue;
+        }
+        const auto& current = it->second;
+        const double delta = base.ns_per_op > 0.0 ? (current.ns_per_op / base.ns_per_op - 1.0) * 100.0 : 0.0;
+        spdlog::info("{:<48} {:>12.1f} {:>12.1f} {:>+8.1f}% {:>10.2f} {:>10.2f}",
+                     name, base.ns_per_op, current.ns_per_op, delta, base.allocs_per_op, current.allocs_per_op);
+    }
+    for (const auto& [name, current] : new_results) {
+        if (!base_results.contains(name)) {
+            spdlog::info("{:<48} {:>12} {:>12.1f} ", name, "(new)", current.ns_per_op);
+        }
+    }
+    return 0;
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+    spdlog::set_level(spdlog::level::info);
+
+    // 命令行参数：
+    //   --filter <substr>           只运行名称包含 substr 的基准
+    //   --min-time <ms>             每次采样的最短时间（默认 50ms）
+    //   --json <file>               把结果写入 JSON 文件
+    //   --compare <base> <new>      对比两个 JSON 结果文件（不运行基准）
+    //   --check                     只执行注册基准时的正确性检查（不运行基准），有检查失败时返回 1
+    std::string filter;
+    std::string json_path;
+    double min_time_ms = 50.0;
+    bool check_only = false;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg(argv[i]);
+        if (arg == "--filter" && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (arg == "--min-time" && i + 1 < argc) {
+            try {
+                min_time_ms = std::stod(argv[++i]);
+            } catch (const std::exception&) {
+                spdlog::warn("无效的 --min-time 参数 '{}'，使用默认值", argv[i]);
+            }
+        } else if (arg == "--json" && i + 1 < argc) {
+            json_path = argv[++i];
+        } else if (arg == "--compare" && i + 2 < argc) {
+            return compare(argv[i + 1], argv[i + 2]);
+        } else if (arg == "--check") {
+            check_only = true;
+        } else {
+            spdlog::warn("未知参数 '{}'", arg);
+        }
+    }
+
+    // 基准过程中只保留警告以上的日志，避免日志输出混入测量
+    spdlog::set_level(check_only ? spdlog::level::info : spdlog::level::warn);
+    bench::Registry registry;
+    bench::register_engine_benchmarks(registry);
+    spdlog::set_level(spdlog::level::info);
+    if (bench::failed_check_count() > 0) {
+        spdlog::error("{} 项正确性检查失败", bench::failed_check_count());
+    }
+    if (check_only) return bench::failed_check_count() > 0 ? 1 : 0;
+
+    const auto results = registry.run(filter, min_time_ms);
+    if (!json_path.empty() && !write_json(results, json_path)) return 1;
+    return bench::failed_check_count() > 0 ? 1 : 0;
+}
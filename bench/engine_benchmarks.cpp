@@ -0,0 +1,514 @@
+#include "bench.hpp"
+#include "engine/core/config.hpp"
+#include "engine/core/context.hpp"
+#include "engine/core/game_state.hpp"
+#include "engine/core/job_system.hpp"
+#include "engine/core/time.hpp"
+#include "engine/audio/audio_player.hpp"
+#include "engine/component/component.hpp"
+#include "engine/component/health_component.hpp"
+#include "engine/component/sprite_component.hpp"
+#include "engine/component/tilelayer_component.hpp"
+#include "engine/component/transform_component.hpp"
+#include "engine/input/input_manager.hpp"
+#include "engine/object/game_object.hpp"
+#include "engine/object/object_pool.hpp"
+#include "engine/object/object_registry.hpp"
+#include "engine/render/animation.hpp"
+#include "engine/render/camera.hpp"
+#include "engine/render/render.hpp"
+#include "engine/render/render_queue.hpp"
+#include "engine/render/render_snapshot.hpp"
+#include "engine/resource/resource_manager.hpp"
+#include "engine/scene/scene.hpp"
+#include "engine/spatial/spatial_grid.hpp"
+#include "engine/utils/profiler.hpp"
+#include "game/data/blueprint_pools.hpp"
+#include "game/data/blueprint_registry.hpp"
+#include <entt/signal/dispatcher.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Window/Event.hpp>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace bench {
+namespace {
+/**
+ * @brief 无窗口的引擎上下文，持有 Context 需要的所有模块（与 Game 的 headless 模式一致）
+ */
+struct BenchContext {
+    engine::core::Config config{"assets/config.json"};
+    entt::dispatcher dispatcher;
+    engine::core::Time time;
+    engine::utils::Profiler profiler;
+    engine::core::JobSystem job_system{1};
+    engine::resource::ResourceManager resource_manager;
+    engine::input::InputManager input_manager{nullptr, &config};
+    engine::render::Renderer renderer{nullptr, &resource_manager};
+    engine::render::Camera camera{sf::Vector2f(config.window_size_)};
+    engine::audio::AudioPlayer audio_player{&resource_manager};
+    engine::core::GameState game_state{sf::Vector2f(config.window_size_), engine::core::State::Playing};
+    engine::core::Context context{dispatcher, input_manager, renderer, camera, resource_manager
+                                , audio_player, game_state, profiler, time, job_system};
+    engine::object::ObjectRegistry registry;    ///< @brief 不属于任何场景的对象使用的注册表
+};
+
+BenchContext& bench_context() {
+    static BenchContext instance;
+    return instance;
+}
+
+/// @brief 基准用的最小组件：每次更新按速度移动所属对象的变换（模拟典型的 get_component + 写变换）
+class MoverComponent final : public engine::component::Component {
+public:
+    MoverComponent(engine::object::GameObject* owner, sf::Vector2f velocity)
+        : Component(owner), velocity_{velocity} {
+        set_tick_phases({engine::utils::ComponentPhase::Update});
+    }
+
+protected:
+    void update(sf::Time delta, engine::core::Context&) override {
+        if (auto* transform = owner_->get_component<engine::component::TransformComponent>(); transform) {
+            transform->translate(velocity_ * delta.asSeconds());
+        }
+    }
+
+private:
+    sf::Vector2f velocity_;
+};
+
+/// @brief 从未添加过的组件类型，用于测量查找未命中
+class AbsentComponent final : public engine::component::Component {
+public:
+    using Component::Component;
+protected:
+    void update(sf::Time, engine::core::Context&) override {}
+};
+
+std::unique_ptr<engine::object::GameObject> make_moving_object(std::unique_ptr<engine::object::GameObject> object, std::size_t index) {
+    const auto fi = static_cast<float>(index);
+    object->add_component<engine::component::TransformComponent>(sf::Vector2f(fi, fi * 0.5f));
+    object->add_component<MoverComponent>(sf::Vector2f(1.0f + fi * 0.001f, -1.0f));
+    return object;
+}
+
+void register_get_component(Registry& registry) {
+    registry.add("GameObject::get_component/hit", [](std::uint64_t iterations) {
+        auto object = make_moving_object(std::make_unique<engine::object::GameObject>(bench_context().registry, "bench_object"), 0);
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            do_not_optimize(object->get_component<engine::component::TransformComponent>());
+        }
+    });
+    registry.add("GameObject::get_component/miss", [](std::uint64_t iterations) {
+        auto object = make_moving_object(std::make_unique<engine::object::GameObject>(bench_context().registry, "bench_object"), 0);
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            do_not_optimize(object->get_component<AbsentComponent>());
+        }
+    });
+}
+
+void register_scene_update(Registry& registry) {
+    for (const std::size_t count : {std::size_t{1000}, std::size_t{10000}}) {
+        // 宏基准：每次操作是一整帧 Scene::update，场景在采样之间复用
+        auto scene = std::make_shared<engine::scene::Scene>("bench_scene", bench_context().context);
+        for (std::size_t i = 0; i < count; ++i) {
+            scene->add_game_object(make_moving_object(scene->create_game_object("bench_object", "bench"), i));
+        }
+        registry.add("Scene::update/" + std::to_string(count), [scene](std::uint64_t iterations) {
+            const sf::Time delta = sf::seconds(1.0f / 60.0f);
+            for (std::uint64_t i = 0; i < iterations; ++i) {
+                scene->update(delta);
+            }
+        });
+    }
+
+    // 只有变换组件的静态装饰物：不参与任何阶段，更新时不应被访问
+    auto idle_scene = std::make_shared<engine::scene::Scene>("bench_idle_scene", bench_context().context);
+    for (std::size_t i = 0; i < 10000; ++i) {
+        auto object = idle_scene->create_game_object("bench_decoration", "decoration");
+        object->add_component<engine::component::TransformComponent>(sf::Vector2f(static_cast<float>(i), 0.0f));
+        idle_scene->add_game_object(std::move(object));
+    }
+    registry.add("Scene::update/10000_idle", [idle_scene](std::uint64_t iterations) {
+        const sf::Time delta = sf::seconds(1.0f / 60.0f);
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            idle_scene->update(delta);
+        }
+    });
+}
+
+void register_scene_render(Registry& registry) {
+    // 精灵分布在 10x10 个视口大小的区域中，相机只看到其中一个：大部分精灵应被剔除
+    static const sf::Texture empty_texture;
+    constexpr std::size_t COUNT = 10000;
+    const sf::Vector2f view_size = bench_context().camera.get_world_view_size();
+    auto scene = std::make_shared<engine::scene::Scene>("bench_render_scene", bench_context().context);
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        const sf::Vector2f position{static_cast<float>(i % 100) * view_size.x * 0.1f, static_cast<float>(i / 100) * view_size.y * 0.1f};
+        auto object = scene->create_game_object("bench_sprite", "bench");
+        object->add_component<engine::component::TransformComponent>(position);
+        object->add_component<engine::component::SpriteComponent>(empty_texture);
+        scene->add_game_object(std::move(object));
+    }
+    registry.add("Scene::render/10000_sprites_culled", [scene](std::uint64_t iterations) {
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            scene->render();
+            do_not_optimize(scene->get_render_stats().submitted);
+        }
+    });
+}
+
+void register_sprite_batching(Registry& registry) {
+    registry.add("Renderer::draw_sprite/record_batched", [](std::uint64_t iterations) {
+        // 录制模式下每次操作把一个精灵写入批次（同一纹理的精灵合并为一条命令）
+        static const sf::Texture empty_texture;
+        auto& renderer = bench_context().renderer;
+        auto& camera = bench_context().camera;
+        engine::render::RenderSnapshot snapshot;
+        sf::Sprite sprite(empty_texture, sf::IntRect({0, 0}, {32, 32}));
+        renderer.begin_recording(snapshot);
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            sprite.setPosition({static_cast<float>(i % 1280), static_cast<float>(i % 720)});
+            renderer.draw_sprite(camera, sprite);
+            if (snapshot.get_sprite_count() >= 10000) snapshot.clear();
+        }
+        renderer.end_recording();
+        do_not_optimize(snapshot.get_commands().size());
+    });
+}
+
+void register_render_queue(Registry& registry) {
+    // 每次操作是一帧：把 N 个精灵按伪随机的 y 入队并排序，代价应与 N 成线性关系
+    static const std::array<sf::Texture, 4> textures{};
+    for (const std::size_t count : {std::size_t{1000}, std::size_t{10000}}) {
+        auto sprites = std::make_shared<std::vector<sf::Sprite>>();
+        auto sort_y = std::make_shared<std::vector<float>>();
+        std::uint32_t seed = 12345u;
+        for (std::size_t i = 0; i < count; ++i) {
+            sprites->emplace_back(textures[i % textures.size()]);
+            seed = seed * 1664525u + 1013904223u;
+            sort_y->push_back(static_cast<float>(seed >> 8) / static_cast<float>(1u << 24) * 2000.f);
+        }
+        registry.add("RenderQueue::sort/" + std::to_string(count), [sprites, sort_y](std::uint64_t iterations) {
+            engine::render::RenderQueue queue;
+            for (std::uint64_t i = 0; i < iterations; ++i) {
+                for (std::size_t j = 0; j < sprites->size(); ++j) {
+                    queue.push(engine::render::RenderLayer::Object, (*sort_y)[j], (*sprites)[j]);
+                }
+                queue.sort();
+                do_not_optimize(queue.get_items().front().key);
+                queue.clear();
+            }
+        });
+    }
+}
+
+/**
+ * @brief 检查快照中世界精灵的绘制顺序：每个四边形的下边缘（单位的脚下、瓦片行的下边缘）单调不减
+ * @return std::size_t 单位与瓦片行交替出现的次数（顺序错误时返回 0）
+ */
+std::size_t check_depth_order(const engine::render::RenderSnapshot& snapshot, const sf::Texture* unit_texture) {
+    const auto& vertices = snapshot.get_vertices();
+    float last_bottom = -std::numeric_limits<float>::infinity();
+    bool last_was_unit = false;
+    std::size_t switches = 0;
+    for (const auto& command : snapshot.get_commands()) {
+        const auto* batch = std::get_if<engine::render::RenderSnapshot::SpriteBatchCommand>(&command);
+        if (!batch) continue;
+        const bool is_unit = batch->texture == unit_texture;
+        for (std::uint32_t quad = 0; quad < batch->vertex_count; quad += engine::render::RenderSnapshot::VERTICES_PER_SPRITE) {
+            float bottom = -std::numeric_limits<float>::infinity();
+            for (std::size_t v = 0; v < engine::render::RenderSnapshot::VERTICES_PER_SPRITE; ++v) {
+                bottom = std::max(bottom, vertices[batch->first_vertex + quad + v].position.y);
+            }
+            if (bottom < last_bottom) {
+                spdlog::error("瓦片与单位的深度顺序错误：下边缘 {} 的四边形画在了 {} 之后", bottom, last_bottom);
+                return 0;
+            }
+            if (quad == 0 && is_unit != last_was_unit) ++switches;
+            last_bottom = bottom;
+            last_was_unit = is_unit;
+        }
+    }
+    return switches;
+}
+
+void register_tile_interleave(Registry& registry) {
+    // 放在 Object 层的瓦片层（例如 fg_tile 中的建筑）按瓦片行加入渲染队列：
+    // 站在某行瓦片下方的单位画在该行之后，站在上方的单位被它遮挡
+    constexpr int MAP_SIZE = 32;
+    constexpr int TILE_SIZE = 64;
+    constexpr std::size_t UNIT_COUNT = 200;
+    static const sf::Texture tile_texture;
+    static const sf::Texture unit_texture;
+    auto scene = std::make_shared<engine::scene::Scene>("bench_interleave_scene", bench_context().context);
+
+    // 每隔一格放一个向上伸出一格的“建筑”瓦片
+    auto tileset = std::make_shared<engine::component::Tileset>();
+    tileset->texture = &tile_texture;
+    tileset->tiles = {{sf::IntRect({0, 0}, {TILE_SIZE, TILE_SIZE * 2}), engine::component::TileType::Solid}};
+    std::vector<engine::component::TileId> tiles(MAP_SIZE * MAP_SIZE, engine::component::EMPTY_TILE);
+    for (int i = 0; i < MAP_SIZE * MAP_SIZE; i += 2) {
+        tiles[static_cast<std::size_t>(i)] = engine::component::make_tile_id(0, 0);
+    }
+    auto layer_object = scene->create_game_object("bench_fg_tile");
+    auto* layer = layer_object->add_component<engine::component::TileLayerComponent>(
+        sf::Vector2i(TILE_SIZE, TILE_SIZE), sf::Vector2i(MAP_SIZE, MAP_SIZE)
+      , std::vector<std::shared_ptr<const engine::component::Tileset>>{tileset}, std::move(tiles));
+    layer->set_render_layer(engine::render::RenderLayer::Object);
+    scene->add_game_object(std::move(layer_object));
+
+    // 单位散布在视口内（y 不与瓦片行的下边缘重合）
+    const sf::Vector2f view_size = bench_context().camera.get_world_view_size();
+    std::uint32_t seed = 54321u;
+    for (std::size_t i = 0; i < UNIT_COUNT; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        const float x = static_cast<float>(seed % static_cast<std::uint32_t>(view_size.x));
+        const float y = std::floor(static_cast<float>((seed >> 12) % static_cast<std::uint32_t>(view_size.y))) + 0.5f;
+        auto object = scene->create_game_object("bench_unit", "bench");
+        object->add_component<engine::component::TransformComponent>(sf::Vector2f{x, y});
+        object->add_component<engine::component::SpriteComponent>(unit_texture);
+        scene->add_game_object(std::move(object));
+    }
+
+    auto& renderer = bench_context().renderer;
+    {
+        engine::render::RenderSnapshot snapshot;
+        renderer.begin_recording(snapshot);
+        scene->render();
+        renderer.end_recording();
+        const std::size_t switches = check_depth_order(snapshot, &unit_texture);
+        check(switches >= 2, fmt::format("瓦片行与单位按深度交错绘制（交替 {} 次）", switches));
+    }
+
+    registry.add("Scene::render/object_tile_interleave", [scene, &renderer](std::uint64_t iterations) {
+        // 每次操作录制一帧：瓦片行与单位一起入队、排序并写入快照
+        engine::render::RenderSnapshot snapshot;
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            renderer.begin_recording(snapshot);
+            scene->render();
+            renderer.end_recording();
+            do_not_optimize(snapshot.get_sprite_count());
+        }
+    });
+}
+
+void register_animation(Registry& registry) {
+    auto animation = std::make_shared<engine::render::Animation>("bench", true);
+    for (int i = 0; i < 8; ++i) {
+        animation->add_frame(sf::IntRect({i * 32, 0}, {32, 32}), sf::seconds(0.1f));
+    }
+    registry.add("Animation::get_frame/8_frames", [animation](std::uint64_t iterations) {
+        sf::Time time = sf::Time::Zero;
+        const sf::Time step = sf::milliseconds(7);
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            do_not_optimize(&animation->get_frame(time));
+            time += step;
+        }
+    });
+}
+
+void register_tile_lookup(Registry& registry) {
+    constexpr int MAP_SIZE = 64;
+    constexpr int TILE_SIZE = 16;
+    static const sf::Texture empty_texture;
+
+    auto owner = std::make_shared<engine::object::GameObject>(bench_context().registry, "bench_tiles");
+    auto tileset = std::make_shared<engine::component::Tileset>();
+    tileset->texture = &empty_texture;
+    tileset->tiles = {{sf::IntRect({0, 0}, {TILE_SIZE, TILE_SIZE}), engine::component::TileType::Normal}
+                    , {sf::IntRect({TILE_SIZE, 0}, {TILE_SIZE, TILE_SIZE}), engine::component::TileType::Solid}};
+    std::vector<engine::component::TileId> tiles;
+    tiles.reserve(MAP_SIZE * MAP_SIZE);
+    for (int i = 0; i < MAP_SIZE * MAP_SIZE; ++i) {
+        tiles.push_back(engine::component::make_tile_id(0, (i % 7 == 0) ? 1 : 0));
+    }
+    auto* layer = owner->add_component<engine::component::TileLayerComponent>(
+        sf::Vector2i(TILE_SIZE, TILE_SIZE), sf::Vector2i(MAP_SIZE, MAP_SIZE)
+      , std::vector<std::shared_ptr<const engine::component::Tileset>>{tileset}, std::move(tiles));
+
+    registry.add("TileLayerComponent::get_tile_type_at_world_pos", [owner, layer](std::uint64_t iterations) {
+        // 只查询地图范围内的坐标，避免越界日志干扰测量
+        constexpr float WORLD_SIZE = static_cast<float>(MAP_SIZE * TILE_SIZE);
+        float x = 0.0f;
+        float y = 0.0f;
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            do_not_optimize(layer->get_tile_type_at_world_pos({x, y}));
+            x += 13.0f;
+            if (x >= WORLD_SIZE) { x -= WORLD_SIZE; y += 7.0f; }
+            if (y >= WORLD_SIZE) y -= WORLD_SIZE;
+        }
+    });
+}
+
+void register_input(Registry& registry) {
+    registry.add("InputManager::update/key_press_release", [](std::uint64_t iterations) {
+        auto& input_manager = bench_context().input_manager;
+        sf::Event::KeyPressed key_pressed{};
+        key_pressed.scancode = sf::Keyboard::Scan::D;
+        sf::Event::KeyReleased key_released{};
+        key_released.scancode = sf::Keyboard::Scan::D;
+        const sf::Event pressed = key_pressed;
+        const sf::Event released = key_released;
+        // 每次操作是一次按下 + 一次释放，都会经过 InputManager::update<sf::Keyboard::Scancode>
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            input_manager.handle_event(pressed);
+            input_manager.handle_event(released);
+        }
+    });
+}
+
+void register_texture_lookup(Registry& registry) {
+    static constexpr std::string_view TEXTURE_PATH = "assets/textures/Buildings/Castle.png";
+    auto& resource_manager = bench_context().resource_manager;
+    if (!resource_manager.load_texture(TEXTURE_PATH)) {
+        spdlog::warn("无法加载基准纹理 '{}'，跳过 ResourceManager::get_texture 基准（请在仓库根目录运行）", TEXTURE_PATH);
+        return;
+    }
+    registry.add("ResourceManager::get_texture/hit", [&resource_manager](std::uint64_t iterations) {
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            do_not_optimize(resource_manager.get_texture(TEXTURE_PATH));
+        }
+    });
+}
+void register_spatial_query(Registry& registry) {
+    // 对象密度固定（每 64x64 像素一个），世界随对象数变大：查询代价应与对象总数无关
+    constexpr float SPACING = 64.0f;
+    constexpr float RANGE = 300.0f;     // 弓箭手射程
+    for (const std::size_t count : {std::size_t{1000}, std::size_t{10000}}) {
+        auto grid = std::make_shared<engine::spatial::SpatialGrid>();
+        const auto side = static_cast<std::size_t>(std::sqrt(static_cast<double>(count)));
+        for (std::size_t i = 0; i < count; ++i) {
+            const sf::Vector2f position{static_cast<float>(i % side) * SPACING, static_cast<float>(i / side) * SPACING};
+            grid->update(static_cast<entt::entity>(i), nullptr, position, engine::object::GameObject::to_id("enemy"));
+        }
+        const float extent = static_cast<float>(side) * SPACING;
+        registry.add("SpatialGrid::query_circle/" + std::to_string(count), [grid, extent](std::uint64_t iterations) {
+            std::vector<engine::object::GameObject*> result;
+            float x = 0.0f;
+            for (std::uint64_t i = 0; i < iterations; ++i) {
+                do_not_optimize(grid->query_circle({x, extent * 0.5f}, RANGE, result));
+                x += 37.0f;
+                if (x >= extent) x -= extent;
+            }
+        });
+        registry.add("SpatialGrid::query_nearest/" + std::to_string(count), [grid, extent](std::uint64_t iterations) {
+            std::vector<engine::object::GameObject*> result;
+            float x = 0.0f;
+            for (std::uint64_t i = 0; i < iterations; ++i) {
+                do_not_optimize(grid->query_nearest({x, extent * 0.5f}, 4, result, RANGE));
+                x += 37.0f;
+                if (x >= extent) x -= extent;
+            }
+        });
+    }
+}
+
+/**
+ * @brief 检查对象池复用的对象恢复到蓝图状态：取出一个敌人，改动变换、生命值、精灵、名称与标签后归还，
+ *        再次取出同一个对象时这些改动都不应保留
+ */
+void check_pool_reset(game::data::BlueprintPools& pools, const game::data::EnemyBlueprint& enemy) {
+    auto* pool = pools.get_pool(enemy.id);
+    if (!pool) {
+        check(false, "敌人蓝图有对应的对象池");
+        return;
+    }
+    auto object = pools.spawn(enemy, {10.f, 20.f});
+    auto* transform = object->get_component<engine::component::TransformComponent>();
+    auto* health = object->get_component<engine::component::HealthComponent>();
+    auto* sprite = object->get_component<engine::component::SpriteComponent>();
+    if (!transform || !health || !sprite) {
+        check(false, "敌人带有变换、生命值与精灵组件");
+        return;
+    }
+    const sf::Vector2f scale = transform->get_scale();
+    const sf::Angle rotation = transform->get_rotation();
+    const sf::Vector2f origin = transform->get_origin();
+    const sf::Color color = sprite->get_sprite().getColor();
+
+    transform->set_scale(scale * 3.f);
+    transform->set_rotation(sf::degrees(rotation.asDegrees() + 90.f));
+    transform->set_origin(origin + sf::Vector2f{5.f, 5.f});
+    health->set_max_health(enemy.stats.hp + 50);
+    health->take_damage(1);
+    sprite->get_sprite().setColor(sf::Color::Red);
+    sprite->set_hidden(true);
+    object->set_name("bench_renamed");
+    object->set_tag("bench_retagged");
+    const auto* released = object.get();
+    const auto hits = pool->get_stats().hits;
+    pool->release(std::move(object));
+
+    object = pools.spawn(enemy, {30.f, 40.f});
+    check(object.get() == released && pool->get_stats().hits == hits + 1, "对象池复用刚归还的对象");
+    check(transform->get_position() == sf::Vector2f(30.f, 40.f) && transform->get_previous_position() == transform->get_position()
+        , "复用的对象位于新的位置且不从旧位置插值");
+    check(transform->get_scale() == scale && transform->get_rotation() == rotation && transform->get_origin() == origin
+        , "复用的对象恢复蓝图的缩放、旋转与原点");
+    check(health->get_max_health() == std::max(1, enemy.stats.hp) && health->get_current_health() == health->get_max_health()
+        , "复用的对象恢复蓝图的最大生命值并回满");
+    check(sprite->get_sprite().getColor() == color && !sprite->is_hidden(), "复用的对象恢复精灵颜色并取消隐藏");
+    check(object->get_name() == enemy.key && object->get_tag() == game::data::ENEMY_TAG, "复用的对象恢复蓝图的名称与标签");
+    pool->release(std::move(object));
+}
+
+void register_blueprint_spawn(Registry& registry) {
+    static game::data::BlueprintRegistry blueprints;
+    if (!blueprints.load(bench_context().resource_manager)) {
+        spdlog::warn("蓝图加载不完整，跳过 BlueprintRegistry::spawn 基准（请在仓库根目录运行）");
+        return;
+    }
+    const auto* enemy = blueprints.find_enemy("slime");
+    if (!enemy) return;
+    auto scene = std::make_shared<engine::scene::Scene>("bench_spawn_scene", bench_context().context);
+    registry.add("BlueprintRegistry::spawn/enemy", [scene, enemy](std::uint64_t iterations) {
+        // 每次操作生成并销毁一个完整的敌人（变换、精灵、动画、生命值、音效）
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            auto object = game::data::BlueprintRegistry::spawn(*scene, *enemy, {static_cast<float>(i % 100), 0.0f});
+            do_not_optimize(object.get());
+        }
+    });
+
+    // 对象池必须先于场景析构（闲置对象的组件在场景的注册表中）
+    struct PooledScene {
+        engine::scene::Scene scene{"bench_pool_scene", bench_context().context};
+        game::data::BlueprintPools pools{scene, blueprints};
+    };
+    auto pooled = std::make_shared<PooledScene>();
+    check_pool_reset(pooled->pools, *enemy);
+    auto* pool = pooled->pools.get_pool(enemy->id);
+    registry.add("BlueprintPools::spawn/enemy", [pooled, pool, enemy](std::uint64_t iterations) {
+        // 每次操作从对象池取出一个敌人再归还（与上面的 spawn/enemy 对比）
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            auto object = pooled->pools.spawn(*enemy, {static_cast<float>(i % 100), 0.0f});
+            do_not_optimize(object.get());
+            pool->release(std::move(object));
+        }
+    });
+}
+} // namespace
+
+void register_engine_benchmarks(Registry& registry) {
+    register_get_component(registry);
+    register_scene_update(registry);
+    register_scene_render(registry);
+    register_sprite_batching(registry);
+    register_render_queue(registry);
+    register_tile_interleave(registry);
+    register_animation(registry);
+    register_tile_lookup(registry);
+    register_input(registry);
+    register_texture_lookup(registry);
+    register_spatial_query(registry);
+    register_blueprint_spawn(registry);
+}
+} // namespace bench
@@ -1,5 +1,6 @@
 #pragma once
 #include "component.hpp"
+#include <entt/core/fwd.hpp>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -17,10 +18,11 @@ namespace engine::component {
 /**
  * @brief GameObject的动画组件。
  *
- * 持有一组Animation对象并控制其播放，
+ * 持有一组Animation对象（可与其他实例共享）并控制其播放，
  * 根据当前帧更新关联的SpriteComponent。
+ * 在场景中由 AnimationSystem 统一推进，不参与组件的逐对象更新。
  */
-class AnimationComponent : public Component {
+class AnimationComponent final : public Component {
     friend class engine::object::GameObject;
 public:
     AnimationComponent(engine::object::GameObject* owner);
@@ -33,9 +35,12 @@ public:
     AnimationComponent& operator=(AnimationComponent&&) = delete;
 
     void add_animation(std::unique_ptr<engine::render::Animation> animation);   ///< @brief 向 animations_ map容器中添加一个动画。
+    void add_animation(std::shared_ptr<const engine::render::Animation> animation);  ///< @brief 添加一个共享的动画（例如来自蓝图，不复制帧数据）
     void play_animation(std::string_view name);                                 ///< @brief 播放指定名称的动画。
     void stop_animation() { is_playing_ = false; }                              ///< @brief 停止当前动画播放。
     void resume_animation() {is_playing_ = true; }                              ///< @brief 恢复当前动画播放。
+    /// @brief 推进动画计时器并更新精灵（由 AnimationSystem 调用），一次性动画刚结束且需要移除所属对象时返回 true
+    bool advance(sf::Time delta);
 
     // --- Getters and Setters ---
     std::string_view get_current_animation_name() const;
@@ -47,12 +52,13 @@ public:
 protected:
     // 核心循环方法
     void update(sf::Time delta, engine::core::Context& context) override;
+    void reset() override;          ///< @brief 停止播放并清除当前动画（动画集合与一次性移除设置保留）
 
 private:
-    /// @brief 动画名称到Animation对象的映射。
-    std::unordered_map<std::string, std::unique_ptr<engine::render::Animation>> animations_;
-    SpriteComponent* sprite_component_obs_ = nullptr;               ///< @brief 指向必需的SpriteComponent的指针
-    engine::render::Animation* current_animation_obs_ = nullptr;    ///< @brief 指向当前播放动画的原始指针
+    /// @brief 动画名称 id（entt::hashed_string）到Animation对象的映射，动画只读，可被多个组件共享。
+    std::unordered_map<entt::id_type, std::shared_ptr<const engine::render::Animation>> animations_;
+    SpriteComponent* sprite_component_obs_ = nullptr;                   ///< @brief 指向必需的SpriteComponent的指针
+    const engine::render::Animation* current_animation_obs_ = nullptr;  ///< @brief 指向当前播放动画的原始指针
 
     sf::Time animation_timer_ = sf::Time::Zero;         ///< @brief 动画播放中的计时器
     bool is_playing_ = false;                           ///< @brief 当前是否有动画正在播放
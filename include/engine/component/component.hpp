@@ -1,5 +1,10 @@
 #pragma once
+#include "engine/component/component_type_id.hpp"
+#include "engine/utils/profiler.hpp"
 #include <SFML/System/Time.hpp>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
 
 namespace engine::object {
     class GameObject;
@@ -9,15 +14,23 @@ namespace engine::core {
     class Context;
 } // namespace engine::core
 
+namespace engine::scene {
+    class Scene;
+} // namespace engine::scene
+
 namespace engine::component {
 /**
  * @brief 组件的抽象基类
  * 
  * 所有具体组件都应该从此基类继承
  * 定义了组件生命周期中可能调用的同样方法
+ *
+ * 组件默认参与所有阶段（handle_input/update/render）。覆盖为空的阶段应在构造函数中用 set_tick_phases 声明不参与，
+ * 场景只遍历各阶段的活动列表，不参与的组件完全不会被访问；也可以在运行时用 set_ticking 开关（例如只在无敌期间更新）。
  */
 class Component {
     friend class engine::object::GameObject;                ///< @brief 他需要调用Component的protected函数
+    friend class engine::scene::Scene;                      ///< @brief 场景维护各阶段的活动列表并调用这些函数
 public:
     Component(engine::object::GameObject* owner);
     virtual ~Component() = default;
@@ -30,13 +43,34 @@ public:
 
     void set_owner(engine::object::GameObject* owner);      ///< @brief 设置拥有此组件的 GameObject
     engine::object::GameObject* get_owner() const;          ///< @brief 获取拥有此组件的 GameObject
+    ComponentTypeId get_type_id() const { return type_id_; }                ///< @brief 获取组件类型 id
+
+    /// @brief 是否参与某个阶段
+    bool is_ticking(engine::utils::ComponentPhase phase) const { return (tick_mask_ & phase_bit(phase)) != 0; }
+
+    /// @brief 开启/关闭某个阶段，所在场景的活动列表会同步更新
+    void set_ticking(engine::utils::ComponentPhase phase, bool enabled);
 
 protected:
     // 关键循环函数（未来将其中一个改为 = 0 以实现纯虚函数
     virtual void handle_input(engine::core::Context&) {}                ///< @brief 处理输入
     virtual void update(sf::Time, engine::core::Context&) = 0;          ///< @brief 更新
     virtual void render(engine::core::Context&) {}                      ///< @brief 渲染
+    virtual void reset() {}                                             ///< @brief 恢复初始运行时状态（对象从对象池取出复用前调用）
+
+    /// @brief 只参与给定的阶段（{} 表示不参与任何阶段），通常在派生类构造函数中调用
+    void set_tick_phases(std::initializer_list<engine::utils::ComponentPhase> phases);
 
     engine::object::GameObject* owner_ = nullptr;           ///< @brief 指向该组件的 GameObject
+
+private:
+    static constexpr std::size_t PHASE_COUNT = 3;
+    static constexpr std::uint32_t NOT_TICKING = static_cast<std::uint32_t>(-1);
+    static constexpr std::uint8_t phase_bit(engine::utils::ComponentPhase phase) { return static_cast<std::uint8_t>(1u << static_cast<unsigned>(phase)); }
+    void notify_tick_changed();                             ///< @brief 通知所在场景同步活动列表
+
+    std::uint8_t tick_mask_ = 0b111;                        ///< @brief 参与的阶段（按 ComponentPhase 的位）
+    std::array<std::uint32_t, PHASE_COUNT> tick_index_{NOT_TICKING, NOT_TICKING, NOT_TICKING};  ///< @brief 在场景各阶段活动列表中的下标
+    ComponentTypeId type_id_ = INVALID_COMPONENT_TYPE;      ///< @brief 组件类型 id（由 GameObject::add_component 设置）
 };
 } // namespace engine::component
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+#include "engine/utils/profiler.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <typeindex>
+#include <typeinfo>
+
+namespace engine::component {
+using ComponentTypeId = std::uint8_t;
+
+inline constexpr std::size_t MAX_COMPONENT_TYPES = 32;                  ///< @brief 组件类型数量上限（GameObject 内联组件表的容量）
+inline constexpr ComponentTypeId INVALID_COMPONENT_TYPE = 0xFF;         ///< @brief 超出上限时返回的无效 id
+
+namespace detail {
+    /// @brief 为新的组件类型分配下一个 id（线程安全），超出上限时返回 INVALID_COMPONENT_TYPE
+    ComponentTypeId register_component_type(const std::type_info& type);
+} // namespace detail
+
+/// @brief 获取 id 对应的组件类型（用于调试与性能分析），id 必须来自 component_type_id
+std::type_index get_component_type_index(ComponentTypeId id);
+
+/**
+ * @brief 获取组件类型在指定阶段的计时区域，id 必须来自 component_type_id
+ * @note 区域在分配类型 id 时一次性注册，这里只读一个数组元素，不加锁，可以在每个组件的热点路径中调用
+ */
+engine::utils::Profiler::ZoneId get_component_zone(ComponentTypeId id, engine::utils::ComponentPhase phase);
+
+/**
+ * @brief 组件类型的稠密 id（类型族计数器），从 0 开始连续分配，可直接作为数组下标
+ *
+ * 每个类型只在第一次调用时分配一次，之后只是读取静态变量，不需要 typeid 与哈希查找。
+ * @tparam T 组件类型
+ */
+template <typename T>
+ComponentTypeId component_type_id() {
+    static const ComponentTypeId id = detail::register_component_type(typeid(T));
+    return id;
+}
+} // namespace engine::component
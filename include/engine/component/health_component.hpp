@@ -4,6 +4,7 @@
 namespace engine::component {
 /**
  * @brief 管理 GameObject 的生命值，处理伤害、治疗，并提供无敌帧功能。
+ * @note 在场景中由 HealthSystem 统一推进无敌计时器，不参与组件的逐对象更新。
  */
 class HealthComponent final : public engine::component::Component {
     friend class engine::object::GameObject;
@@ -45,10 +46,12 @@ public:
     void set_max_health(int max_health);                            ///< @brief 设置最大生命值 (确保不小于 1)。
     void set_invincible(sf::Time duration);                         ///< @brief 设置 GameObject 进入无敌状态，持续时间为 duration 秒。
     void set_invincibility_duration(sf::Time duration) { invincibility_duration_ = duration; } ///< @brief 设置无敌状态持续时间。
+    void tick_invincibility(sf::Time delta);                        ///< @brief 推进无敌计时器（由 HealthSystem 调用）
 
 protected:
     // 核心循环函数
     void update(sf::Time delta, engine::core::Context& context) override;
+    void reset() override;          ///< @brief 恢复构造时的最大生命值与无敌时长，回满生命值并取消无敌
 
 private:
     int max_health_ = 1;            ///< @brief 最大生命值
@@ -56,5 +59,7 @@ private:
     bool is_invincible_ = false;    ///< @brief 是否处于无敌状态
     sf::Time invincibility_duration_ = sf::seconds(2.f);    ///< @brief 受伤后无敌的总时长（秒）
     sf::Time invincibility_timer_ = sf::Time::Zero;         ///< @brief 无敌时间计时器（秒）
+    int initial_max_health_ = 1;                            ///< @brief 构造时的最大生命值（reset 时恢复）
+    sf::Time initial_invincibility_duration_ = sf::seconds(2.f);    ///< @brief 构造时的无敌时长（reset 时恢复）
 };
 } // namespace engine::component
@@ -1,5 +1,6 @@
 #pragma once
 #include "component.hpp"
+#include "engine/render/render_queue.hpp"
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/Texture.hpp>
@@ -17,6 +18,8 @@ class TransformComponent;
  * @brief 管理 GameObject 的视觉表示，通过持有一个 Sprite 对象。
  *
  * 协调 Sprite 数据和渲染逻辑，并与 TransformComponent 交互。
+ * 渲染前由 SpriteSyncSystem 统一同步变换并登记到场景的精灵网格；
+ * 精灵不参与 render 阶段的活动列表，而是由场景按相机视口剔除后加入渲染队列，按渲染层与 y 坐标排序绘制。
  */
 class SpriteComponent final : public engine::component::Component {
     friend class engine::object::GameObject;            // 友元不能继承，必须每个子类单独添加
@@ -28,13 +31,22 @@ public:
     sf::Sprite& get_sprite() { return sprite_; }                           ///< @brief 获取精灵
     bool is_hidden() { return is_hidden_; }                               ///< @brief 获取隐藏状态
     void set_hidden(bool hide) { is_hidden_ = hide; }                      ///< @brief 设置隐藏状态
+    engine::render::RenderLayer get_render_layer() const { return render_layer_; }     ///< @brief 获取渲染层
+    void set_render_layer(engine::render::RenderLayer layer) { render_layer_ = layer; } ///< @brief 设置渲染层
+
+    /// @brief 把精灵的原点、位置、缩放、旋转同步到变换（位置按 alpha 插值，由 SpriteSyncSystem 调用）
+    void sync_transform(const TransformComponent& transform, float alpha);
+    /// @brief 按渲染层与精灵位置（对象脚下）的 y 加入渲染队列（隐藏时不加入），由场景对可见的精灵调用
+    void enqueue(engine::render::RenderQueue& queue);
 private:
     void update(sf::Time, engine::core::Context&) override {}               ///< @brief 更新函数留空
-    void render(engine::core::Context& context) override;                   ///< @brief 渲染函数需要覆盖
-
-    TransformComponent* transform_obs_ = nullptr;                           ///< @brief 变换组件的观察指针
+    void render(engine::core::Context&) override {}                         ///< @brief 不参与 render 阶段（由场景剔除后调用 enqueue）
+    void reset() override;                                                  ///< @brief 恢复构造时的纹理区域与颜色并取消隐藏（渲染层属于蓝图，保持不变）
 
     sf::Sprite sprite_;                                                     ///< @brief 内部储存的精灵
+    sf::IntRect initial_texture_rect_;                                      ///< @brief 构造时的纹理区域（reset 时恢复）
+    sf::Color initial_color_;                                               ///< @brief 构造时的颜色（reset 时恢复）
     bool is_hidden_ = false;                                                ///< @brief 是否隐藏（不渲染）
+    engine::render::RenderLayer render_layer_ = engine::render::RenderLayer::Object;   ///< @brief 渲染层
 };
 } // namespace engine::component
\ No newline at end of file
@@ -1,19 +1,28 @@
 #pragma once
 #include "component.hpp"
+#include "engine/render/render_queue.hpp"
+#include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <vector>
 
 namespace engine::core {
     class Context;
 } // namespace engine::core
 
+namespace engine::render {
+    class Renderer;
+} // namespace engine::render
+
 namespace engine::component {
 /**
  * @brief 定义瓦片的类型，用于游戏逻辑（例如碰撞）。
  */
-enum class TileType {
+enum class TileType : std::uint8_t {
     Empty,      ///< @brief 空白瓦片
     Normal,     ///< @brief 普通瓦片
     Solid,      ///< @brief 静止可碰撞瓦片
@@ -30,45 +39,78 @@ enum class TileType {
 };
 
 /**
- * @brief 包含单个瓦片的渲染和逻辑信息。
+ * @brief 瓦片 id：高 8 位为图块集在瓦片层中的下标，低 24 位为图块集内的 id
+ */
+using TileId = std::uint32_t;
+inline constexpr TileId EMPTY_TILE = 0xFFFFFFFFu;      ///< @brief 空白瓦片的 id
+
+/// @brief 由图块集下标与图块集内的 id 打包瓦片 id
+constexpr TileId make_tile_id(std::uint8_t tileset_index, std::uint32_t local_id) {
+    return (static_cast<TileId>(tileset_index) << 24) | (local_id & 0x00FFFFFFu);
+}
+
+/**
+ * @brief 图块集中一个图块的渲染和逻辑信息。
+ */
+struct TileDefinition {
+    sf::IntRect texture_rect;               ///< @brief 在图块集纹理中的区域（可以大于瓦片尺寸，此时底部对齐、向右上伸出）
+    TileType type = TileType::Normal;       ///< @brief 瓦片的逻辑类型
+};
+
+/**
+ * @brief 图块集：纹理与按图块集内 id 索引的图块表，由使用它的所有瓦片层共享。
  */
-struct TileInfo {
-    TileInfo(sf::Sprite& s, TileType t = TileType::Empty)
-        : sprite(std::move(s)), type(t) {
-    }
-    sf::Sprite sprite;          ///< @brief 瓦片的视觉表示
-    TileType type;              ///< @brief 瓦片的逻辑类型
+struct Tileset {
+    const sf::Texture* texture = nullptr;   ///< @brief 图块集纹理（由 ResourceManager 持有）
+    std::vector<TileDefinition> tiles;      ///< @brief 图块表，下标为图块集内的 id
 };
 
 /**
  * @brief 管理和渲染瓦片地图层。
  *
- * 存储瓦片地图的布局、每个瓦片的精灵信息和类型。
- * 负责在渲染阶段绘制可见的瓦片。
+ * 每个格子只存一个打包的瓦片 id 和一个类型字节，纹理区域与类型由共享的图块集表提供，
+ * 逻辑查询（get_tile_type_at）只读取类型字节。
+ * 负责在渲染阶段绘制可见的瓦片，顶点数据直接由 id 数组和图块集表生成。
+ * 渲染缓存按 CHUNK_SIZE x CHUNK_SIZE 个瓦片分块：每块有自己的 RenderTexture，
+ * 只有块内瓦片改变时才重建该块；与相机视口不相交的块不绘制也不重建，
+ * 连续 CHUNK_EVICT_FRAMES 帧未被看到的块释放其纹理（再次可见时重建），显存占用与视口大小相关而不是与地图大小相关。
+ * 地面层（默认）直接绘制，位于所有对象之下；其它渲染层加入场景的渲染队列，与对象一起按层和 y 排序。
+ * 排序的层按瓦片行缓存（块纹理中每行占一条带，高度为瓦片高加上最大伸出量），每行一个精灵，深度取该行的下边缘：
+ * 放在 Object 层时（例如 fg_tile 中的建筑、树木），站在某行瓦片下方的单位画在它前面，站在上方的单位被它遮挡。
+ * 流水线模式下主线程可能仍在提交引用块纹理的上一帧快照：重建时绘制到块的后备纹理再与当前纹理交换，
+ * 不再使用的纹理通过 Renderer::retire_texture 延迟释放，都不会改动或释放正在提交的纹理。
  */
 class TileLayerComponent final : public Component {
     friend class engine::object::GameObject;
 public:
+    static constexpr int CHUNK_SIZE = 16;                       ///< @brief 缓存块的边长（瓦片数）
+    static constexpr std::uint64_t CHUNK_EVICT_FRAMES = 300;    ///< @brief 块连续多少帧未被看到后释放缓存纹理
+
     // TileLayerComponent() = default;
     /**
      * @brief 构造函数
      * @param tile_size 单个瓦片尺寸（像素）
      * @param map_size 地图尺寸（瓦片数）
-     * @param tiles 初始化瓦片数据的容器 (会被移动)
+     * @param tilesets 瓦片 id 引用的图块集（下标即 id 的高 8 位）
+     * @param tiles 每个格子的瓦片 id (会被移动，按"行主序"存储)
      */
     TileLayerComponent(engine::object::GameObject* owner
                      , sf::Vector2i tile_size
                      , sf::Vector2i map_size
-                     , std::vector<TileInfo>&& tiles
+                     , std::vector<std::shared_ptr<const Tileset>> tilesets
+                     , std::vector<TileId>&& tiles
     );
     ~TileLayerComponent();
 
     /**
-     * @brief 根据瓦片坐标获取瓦片信息
+     * @brief 根据瓦片坐标获取瓦片 id
      * @param pos 瓦片坐标 (0 <= x < map_size_.x, 0 <= y < map_size_.y)
-     * @return const TileInfo* 指向瓦片信息的指针，如果坐标无效则返回 nullptr
+     * @return TileId 瓦片 id，如果坐标无效则返回 EMPTY_TILE
      */
-    const TileInfo* get_tile_info_at(sf::Vector2i pos) const;
+    TileId get_tile_at(sf::Vector2i pos) const;
+
+    /// @brief 获取瓦片 id 对应的图块定义，空白或无效 id 返回 nullptr
+    const TileDefinition* get_tile_definition(TileId id) const;
 
     /**
      * @brief 根据瓦片坐标获取瓦片类型
@@ -87,12 +129,26 @@ public:
     sf::Vector2i get_tile_size() const { return tile_size_; }                                                              ///< @brief 获取单个瓦片尺寸
     sf::Vector2i get_map_size() const { return map_size_; }                                                                ///< @brief 获取地图尺寸
     sf::Vector2f get_world_size() const { return sf::Vector2f(map_size_.x * tile_size_.x, map_size_.y * tile_size_.y); }   ///< @brief 获取地图世界尺寸
-    const std::vector<TileInfo>& get_tiles() const { return tiles_; }                                                      ///< @brief 获取瓦片容器
+    const std::vector<TileId>& get_tiles() const { return tiles_; }                                                        ///< @brief 获取瓦片 id 数组
+    const std::vector<TileType>& get_tile_types() const { return types_; }                                                 ///< @brief 获取瓦片类型数组
+    const std::vector<std::shared_ptr<const Tileset>>& get_tilesets() const { return tilesets_; }                          ///< @brief 获取图块集
     const sf::Vector2f& get_offset() const { return offset_; }                                                             ///< @brief 获取瓦片层的偏移量
     bool is_hidden() const { return is_hidden_; }                                                                          ///< @brief 获取是否隐藏（不渲染）
+    engine::render::RenderLayer get_render_layer() const { return render_layer_; }                                         ///< @brief 获取渲染层
+
+    std::size_t get_resident_chunk_count() const { return resident_chunks_; }                                              ///< @brief 获取当前持有缓存纹理的块数
+
+    /**
+     * @brief 替换一个瓦片，只使其所在块的缓存失效（新瓦片比已有瓦片伸出得更多时，所有块的尺寸都要变，全部失效）
+     * @param pos 瓦片坐标
+     * @param tile 新的瓦片 id（EMPTY_TILE 表示清空）
+     * @return bool 坐标越界或 id 无效时返回 false
+     */
+    bool set_tile_at(sf::Vector2i pos, TileId tile);
 
     void set_offset(sf::Vector2f offset) { offset_ = std::move(offset); }                                                  ///< @brief 设置瓦片层的偏移量
     void set_hidden(bool hidden) { is_hidden_ = hidden; }                                                                  ///< @brief 设置是否隐藏（不渲染）
+    void set_render_layer(engine::render::RenderLayer layer);                                                              ///< @brief 设置渲染层（地面层与排序层的块布局不同，切换时所有块失效）
 
 protected:
     // 核心循环方法
@@ -100,17 +156,40 @@ protected:
     void render(engine::core::Context& context) override;
 
 private:
-    void rebuild_cache() const;
+    /// @brief 一个缓存块
+    struct Chunk {
+        std::unique_ptr<sf::RenderTexture> texture;         ///< @brief 块的缓存纹理（未构建或已释放时为空）
+        std::unique_ptr<sf::RenderTexture> back_texture;    ///< @brief 后备纹理：上一次重建前的缓存纹理，可能仍被上一帧的快照引用，下一次重建时才绘制
+        std::vector<sf::Sprite> sprites;                    ///< @brief 绘制缓存纹理的精灵（地面层整块一个，排序层每个非空瓦片行一个）
+        std::vector<sf::Sprite> fallback_sprites;           ///< @brief 缓存纹理创建失败时逐个瓦片绘制用的精灵
+        std::uint64_t last_seen_frame = 0;                  ///< @brief 最近一次可见的帧序号
+        bool dirty = true;                                  ///< @brief 块内瓦片改变后需要重建
+    };
+
+    sf::Vector2i get_chunk_count() const;                           ///< @brief 横向与纵向的块数
+    bool is_row_sorted() const { return render_layer_ != engine::render::RenderLayer::Ground; }    ///< @brief 是否按瓦片行加入渲染队列
+    int get_row_pitch() const;                                      ///< @brief 排序层的块纹理中一个瓦片行的条带高度（像素）
+    sf::Vector2f get_tile_overhang(TileId tile) const;              ///< @brief 瓦片图块超出瓦片尺寸的部分（向右、向上伸出）
+    void mark_chunk_dirty(sf::Vector2i chunk_pos);                  ///< @brief 使一个块的缓存失效（越界时忽略）
+    bool rebuild_chunk(Chunk& chunk, sf::Vector2i chunk_pos);       ///< @brief 把块内的瓦片绘制到块的缓存纹理，失败时返回 false
+    void release_chunk(Chunk& chunk);                               ///< @brief 释放块的缓存纹理与后备纹理（交给 Renderer 延迟释放）
+    void evict_unseen_chunks();                                     ///< @brief 释放长时间未被看到的块
+    void build_fallback_sprites(Chunk& chunk, sf::Vector2i chunk_pos) const;  ///< @brief 为块内每个瓦片生成精灵（缓存纹理创建失败时的回退）
 
     sf::Vector2i tile_size_;            ///< @brief 单个瓦片尺寸（像素）
     sf::Vector2i map_size_;             ///< @brief 地图尺寸（瓦片数）
-    std::vector<TileInfo> tiles_;       ///< @brief 存储所有瓦片信息 (按"行主序"存储, index = y * map_width_ + x)
+    std::vector<std::shared_ptr<const Tileset>> tilesets_;     ///< @brief 图块集（与其它瓦片层共享）
+    std::vector<TileId> tiles_;         ///< @brief 瓦片 id (按"行主序"存储, index = y * map_width_ + x)
+    std::vector<TileType> types_;       ///< @brief 瓦片类型，与 tiles_ 一一对应（逻辑查询只读这里）
     sf::Vector2f offset_ = {0.f, 0.f};  ///< @brief 瓦片层在世界中的偏移量 (瓦片层通常不需要缩放及旋转，因此不引入Transform组件)
                                         ///< offset_ 最好也保持默认的0，以免增加不必要的复杂性
     bool is_hidden_ = false;            ///< @brief 是否隐藏（不渲染）
+    engine::render::RenderLayer render_layer_ = engine::render::RenderLayer::Ground;  ///< @brief 渲染层
 
-    mutable sf::RenderTexture render_texture_;                              // mutable 因为 render() 是 const 上下文也能重建
-    mutable bool cache_dirty_ = true;                                       // 是否需要重新绘制到 render_texture_
-    mutable std::unique_ptr<sf::Sprite> cached_sprite_ = nullptr;           // 从 render_texture_ 生成的 sprite，每帧只 draw 这一个
+    std::vector<Chunk> chunks_;             ///< @brief 缓存块（按"行主序"存储, index = chunk_y * chunk_count.x + chunk_x）
+    sf::Vector2f max_overhang_ = {0.f, 0.f};    ///< @brief 所有瓦片图块超出瓦片尺寸的最大值（用于剔除与块纹理的尺寸）
+    std::uint64_t frame_ = 0;               ///< @brief 渲染帧序号
+    engine::render::Renderer* renderer_obs_ = nullptr;  ///< @brief 最近一次渲染使用的渲染器（释放块纹理时交给它延迟释放，生命周期长于所有场景）
+    std::size_t resident_chunks_ = 0;       ///< @brief 持有缓存纹理的块数
 };
 } // namespace engine::component
\ No newline at end of file
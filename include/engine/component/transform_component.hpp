@@ -45,17 +45,33 @@ public:
     const sf::Vector2f& get_scale() const { return scale_; }                      ///< @brief 获取缩放
     sf::Vector2f get_origin() const { return origin_; }                           ///< @brief 获取原点
     void set_origin(sf::Vector2f origin) { origin_ = std::move(origin); }         ///< @brief 设置原点
-    void set_position(sf::Vector2f position) { position_ = std::move(position); } ///< @brief 设置位置
+    void set_position(sf::Vector2f position) { position_ = previous_position_ = position; }  ///< @brief 设置位置（瞬移：同时重置插值起点，不在两次更新之间插值；连续移动请用 translate）
     void set_rotation(sf::Angle angle) { angle_ = angle; }                        ///< @brief 设置旋转角度
     void set_scale(sf::Vector2f scale) { scale_ = std::move(scale); }             ///< @brief 设置缩放，应用缩放时应同步更新Sprite偏移量
     void translate(sf::Vector2f offset) { position_ += offset; }                  ///< @brief 移动（sf::Sprite::move)    
 
+    // --- 渲染插值 ---
+    const sf::Vector2f& get_previous_position() const { return previous_position_; }  ///< @brief 获取上一次固定步长更新前的位置
+    void store_previous_position() { previous_position_ = position_; }                 ///< @brief 记录当前位置（每次固定步长更新前调用）
+    /// @brief 获取在上一次位置与当前位置之间插值的位置（alpha 通常来自 Time::get_interpolation_alpha）
+    sf::Vector2f get_interpolated_position(float alpha) const { return previous_position_ + (position_ - previous_position_) * alpha; }
+
+protected:
+    void reset() override;          ///< @brief 恢复构造时的位置、缩放、旋转与原点（对象从对象池取出复用前调用）
+
 private:
     void update(sf::Time, engine::core::Context&) override {} ///< @brief 覆盖纯虚函数，这里不需要实现
     
     sf::Vector2f position_ = {0.f, 0.f};        ///< @brief 位置
+    sf::Vector2f previous_position_ = {0.f, 0.f};   ///< @brief 上一次固定步长更新前的位置（用于渲染插值）
     sf::Vector2f scale_ = {1.f, 1.f};           ///< @brief 缩放
     sf::Angle angle_ = sf::degrees(0.f);        ///< @brief 角度制，单位：度（约定，实际上也支持弧度）
     sf::Vector2f origin_ = {0.f, 0.f};          ///< @brief 原点
+
+    // --- 构造时的值（reset 时恢复） ---
+    sf::Vector2f initial_position_ = {0.f, 0.f};    ///< @brief 初始位置
+    sf::Vector2f initial_scale_ = {1.f, 1.f};       ///< @brief 初始缩放
+    sf::Angle initial_angle_ = sf::degrees(0.f);    ///< @brief 初始角度
+    sf::Vector2f initial_origin_ = {0.f, 0.f};      ///< @brief 初始原点
 };
 } // namespace engine::component
\ No newline at end of file
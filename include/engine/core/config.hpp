@@ -40,9 +40,21 @@ public:
 
     // 图形设置
     bool vsync_enabled_ = false;                    ///< @brief 垂直同步（默认关闭）
+    bool texture_atlas_enabled_ = true;             ///< @brief 启动时把 atlas_sources_ 中的图片打包成图集
+    unsigned int atlas_page_size_ = 8192;           ///< @brief 图集页边长上限（受显卡最大纹理尺寸限制）
+    std::vector<std::string> atlas_sources_ = {     ///< @brief 打包进图集的图片或目录
+        "assets/textures/Units",
+        "assets/textures/Enemy",
+        "assets/textures/FX",
+        "assets/textures/UI/weapon_icon.png"
+    };
 
     // 性能设置
     unsigned int target_fps_ = 60;                  ///< @brief 目标FPS，0表示无限制
+    unsigned int max_updates_per_frame_ = 5;        ///< @brief 每帧最多固定步长更新次数，0表示无限制
+    bool carry_over_lag_ = false;                   ///< @brief 达到更新上限后是否保留剩余时间（默认丢弃）
+    bool pipelined_rendering_ = false;              ///< @brief 是否在模拟线程上更新下一帧、主线程同时提交当前帧
+    unsigned int worker_threads_ = 0;               ///< @brief 线程池工作线程数，0表示自动（硬件线程数 - 1）
 
     // 音频设置
     float music_volume_ = 100.f;
@@ -58,7 +70,8 @@ public:
         {Action::MoveDown, {Scancode::S, Scancode::Down}},
         {Action::Jump, {Scancode::J, Scancode::Space}},
         {Action::Attack, {Scancode::K}},
-        {Action::Pause, {Scancode::P, Scancode::Escape}}
+        {Action::Pause, {Scancode::P, Scancode::Escape}},
+        {Action::FastForward, {Scancode::F}}
     };
     std::unordered_map<Action, std::vector<Button>> mouse_input_mappings_ = {
         {Action::MouseLeft, {Button::Left}},
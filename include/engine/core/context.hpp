@@ -19,8 +19,14 @@ namespace engine::audio {
     class AudioPlayer;
 } // namespace engine::audio
 
+namespace engine::utils {
+    class Profiler;
+} // namespace engine::utils
+
 namespace engine::core {
 class GameState;
+class Time;
+class JobSystem;
 
 /**
  * @brief 持有对核心引擎模块引用的上下文对象
@@ -35,6 +41,9 @@ public:
      * @param renderer 对 Renderer 实例的引用。
      * @param camera 对 Camera 实例的引用。
      * @param resource_manager 对 ResourceManager 实例的引用。
+     * @param profiler 对 Profiler 实例的引用。
+     * @param time 对 Time 实例的引用。
+     * @param job_system 对 JobSystem 实例的引用。
      */
     Context(entt::dispatcher& dispatcher
           , engine::input::InputManager& input_manager
@@ -42,7 +51,10 @@ public:
           , engine::render::Camera& camera
           , engine::resource::ResourceManager& resource_manager
           , engine::audio::AudioPlayer& audio_player
-          , engine::core::GameState& game_state);
+          , engine::core::GameState& game_state
+          , engine::utils::Profiler& profiler
+          , engine::core::Time& time
+          , engine::core::JobSystem& job_system);
     ~Context() = default;
 
     // 禁止拷贝和移动，Context 对象通常是唯一的或按需创建/传递
@@ -59,6 +71,9 @@ public:
     engine::resource::ResourceManager& get_resource_manager() const { return resource_manager_; }///< @brief 获取资源管理器
     engine::audio::AudioPlayer& get_audio_player() const { return audio_player_; }               ///< @brief 获取音频播放器
     engine::core::GameState& get_game_state() const { return game_state_; }                      ///< @brief 获取游戏状态
+    engine::utils::Profiler& get_profiler() const { return profiler_; }                          ///< @brief 获取性能分析器
+    engine::core::Time& get_time() const { return time_; }                                       ///< @brief 获取时间组件
+    engine::core::JobSystem& get_job_system() const { return job_system_; }                      ///< @brief 获取共享线程池
 
 private:
     entt::dispatcher& dispatcher_;                              ///< @brief 事件分发器
@@ -68,5 +83,8 @@ private:
     engine::resource::ResourceManager& resource_manager_;       ///< @brief 资源管理器
     engine::audio::AudioPlayer& audio_player_;                  ///< @brief 音频播放器
     engine::core::GameState& game_state_;                       ///< @brief 游戏状态
+    engine::utils::Profiler& profiler_;                         ///< @brief 性能分析器
+    engine::core::Time& time_;                                  ///< @brief 时间组件
+    engine::core::JobSystem& job_system_;                       ///< @brief 共享线程池
 };
 } // namespace engine::core
\ No newline at end of file
@@ -2,12 +2,17 @@
 #include "entt/signal/fwd.hpp"
 #include <memory>
 #include <functional>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
 
 // 前向声明，减少头文件依赖，增加编译速度
 namespace sf {
     class RenderWindow;
     class Time;
     class Event;
+    class Clock;
 } // namespace sf
 
 namespace engine::resource {
@@ -17,10 +22,13 @@ namespace engine::resource {
 namespace engine::render {
     class Renderer;
     class Camera;
+    class RenderSnapshot;
 } // namespace engine::render
 
 namespace engine::input {
     class InputManager;
+    class InputRecorder;
+    class InputPlayer;
 } // namespace engine::input
 
 namespace engine::scene {
@@ -31,8 +39,13 @@ namespace engine::audio {
     class AudioPlayer;
 } // namespace engine::audio
 
+namespace engine::utils {
+    class Profiler;
+} // namespace engine::utils
+
 namespace engine::core {
 class Time;
+class JobSystem;
 class Config;
 class Context;
 class GameState;
@@ -41,7 +54,11 @@ class GameState;
  */
 class Game final {
 public:
-    Game();
+    /**
+     * @brief 构造函数
+     * @param headless 是否以无头模式运行（不创建窗口，不轮询事件，不渲染），用于在无显示环境下测量模拟吞吐量
+     */
+    explicit Game(bool headless = false);
     ~Game();
 
     /**
@@ -49,6 +66,26 @@ public:
      */
     void run();
 
+    /**
+     * @brief 无头模式运行：以固定步长 Time::get_frame_duration() 尽可能快地驱动场景更新
+     * @param ticks 需要执行的固定步长更新次数
+     * @return double 实测吞吐量（ticks/s），非无头模式下返回 0
+     */
+    double run_headless(std::uint64_t ticks);
+
+    /**
+     * @brief 开始录制输入：之后每一帧传给 InputManager 的事件及其 tick 都会被记录，运行结束时写入文件
+     * @param filepath 录制文件路径
+     */
+    void start_recording(std::string_view filepath);
+
+    /**
+     * @brief 从文件回放输入：事件取代窗口事件，并按录制时的帧结构执行固定步长更新，回放结束后退出
+     * @param filepath 录制文件路径
+     * @return 加载失败返回 false
+     */
+    bool start_replay(std::string_view filepath);
+
     /**
      * @brief 注册用于设置初始游戏场景的函数。
      *        这个函数将在 SceneManager 初始化后被调用。
@@ -63,17 +100,39 @@ public:
 
 private:
     void handle_event();
+    void poll_events();                             ///< @brief 轮询窗口事件或回放事件（只能在主线程调用）
+    void dispatch_event(const sf::Event& event);    ///< @brief 把一个事件交给 ImGui、调试快捷键、录制器和 InputManager
+    void stop_recording();                          ///< @brief 结束录制并写出文件
+    void fixed_update();                            ///< @brief 累加时间并执行本帧的固定步长更新
     void update(sf::Time delta);
     void render();
+    void present();                                 ///< @brief 绘制调试叠加层并显示当前帧
+
+    /**
+     * @brief 流水线主循环：模拟线程更新并录制第 N+1 帧的绘制快照，主线程同时提交第 N 帧
+     * @note 由配置 performance.pipelined_rendering 开启
+     */
+    void run_pipelined();
+
+    /// @brief 处理场景输入、执行固定步长更新，并把场景渲染录制到 snapshot（在模拟线程运行）
+    void simulate_and_record(engine::render::RenderSnapshot& snapshot);
 
     // 事件处理函数
     void on_quit_event();
+    void on_fast_forward();                         ///< @brief 切换快进倍率（FastForward 动作按下时）
+
+    bool headless_ = false;                         ///< @brief 是否为无头模式（window_ 为空）
+    bool is_running_ = true;                        ///< @brief 主循环是否继续运行（退出事件会将其置为 false）
+    bool imgui_initialized_ = false;                ///< @brief ImGui-SFML 是否初始化成功
+    bool show_profiler_ = false;                    ///< @brief 是否显示性能分析叠加层（F3 切换）
+    std::uint64_t tick_ = 0;                        ///< @brief 已执行的固定步长更新次数
 
     // 配置组件，优先加载，优先级最高
     std::unique_ptr<engine::core::Config> config_;
 
-    // 游戏主窗口
+    // 游戏主窗口（无头模式下为空）
     std::unique_ptr<sf::RenderWindow> window_;
+    std::unique_ptr<sf::Clock> imgui_clock_;        ///< @brief ImGui 帧计时
 
     /// @brief 游戏场景设置函数，用于在运行游戏前设置初始场景 (GameApp不再决定初始场景是什么)
     std::function<void(engine::core::Context&)> scene_setup_func_;
@@ -81,12 +140,20 @@ private:
     // 引擎组件
     std::unique_ptr<entt::dispatcher> dispatcher_;                              ///< @brief 事件分发器
     std::unique_ptr<engine::core::Time> time_;                                  ///< @brief 时间组件
+    std::unique_ptr<engine::utils::Profiler> profiler_;                         ///< @brief 性能分析器
+    std::unique_ptr<engine::core::JobSystem> job_system_;                       ///< @brief 共享线程池（模拟线程也运行在其中）
     std::unique_ptr<engine::resource::ResourceManager> resource_manager_;       ///< @brief 资源管理器组件
     std::unique_ptr<engine::input::InputManager> input_manager_;                ///< @brief 输入管理器组件
     std::unique_ptr<engine::render::Renderer> renderer_;                        ///< @brief 渲染器组件
     std::unique_ptr<engine::render::Camera> camera_;                            ///< @brief 摄像机组件
     std::unique_ptr<engine::audio::AudioPlayer> audio_player_;                  ///< @brief 音频播放组件
     std::unique_ptr<engine::core::GameState> game_state_;                       ///< @brief 游戏状态组件
+    // 输入录制与回放（可选）
+    std::unique_ptr<engine::input::InputRecorder> recorder_;                    ///< @brief 输入录制器，为空表示不录制
+    std::string record_path_;                                                   ///< @brief 录制文件路径
+    std::unique_ptr<engine::input::InputPlayer> player_;                        ///< @brief 输入回放器，为空表示使用窗口事件
+    std::vector<sf::Event> replay_events_;                                      ///< @brief 当前帧回放的事件（复用内存）
+
     std::unique_ptr<engine::core::Context> context_;                            ///< @brief ！上下文组件，最后初始化的组件
     std::unique_ptr<engine::scene::SceneManager> scene_manager_;                ///< @brief ！场景管理器,依赖上下文，最后初始化
 };
@@ -31,6 +31,13 @@ public:
      * @param initial_state 游戏的初始状态，默认为 Title
      */
     explicit GameState(sf::RenderWindow* window, State initial_state = State::Title);
+
+    /**
+     * @brief 构造函数（无头模式），不依赖窗口，窗口尺寸与逻辑尺寸均由参数给出。
+     * @param logical_size 逻辑分辨率
+     * @param initial_state 游戏的初始状态，默认为 Title
+     */
+    explicit GameState(sf::Vector2f logical_size, State initial_state = State::Title);
     ~GameState() = default;
 
     void set_window_size(sf::Vector2u new_size);
@@ -48,7 +55,8 @@ public:
     bool is_game_over() const { return current_state_ == State::GameOver; }
 
 private:    
-    sf::RenderWindow* window_obs_ = nullptr;              ///< @brief SDL窗口，用于获取窗口大小
+    sf::RenderWindow* window_obs_ = nullptr;              ///< @brief SDL窗口，用于获取窗口大小（无头模式下为空）
     State current_state_ = State::Title;        ///< @brief 当前游戏状态
+    sf::Vector2f headless_logical_size_;        ///< @brief 无头模式下的逻辑分辨率（同时作为窗口尺寸）
 };
 } // namespace engine::core
\ No newline at end of file
@@ -0,0 +1,115 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace engine::core {
+/**
+ * @brief 引擎共享的工作窃取线程池
+ *
+ * 每个工作线程持有自己的双端队列：自己从尾部取任务（缓存友好），空闲时从其他线程的队列头部窃取。
+ * 支持任务依赖（依赖全部完成后才入队）和按区间切分的 parallel_for。
+ * 等待任务的线程（包括主线程）会帮忙执行队列中的任务，因此在任务中再提交并等待子任务不会死锁。
+ */
+class JobSystem final {
+    struct Counter;
+public:
+    /**
+     * @brief 任务句柄，可用于等待任务完成或作为其他任务的依赖
+     * @note 默认构造的句柄视为已完成
+     */
+    class JobHandle {
+        friend class JobSystem;
+    public:
+        JobHandle() = default;
+        bool is_done() const;                       ///< @brief 任务（及其所有子任务）是否已完成
+    private:
+        explicit JobHandle(std::shared_ptr<Counter> counter) : counter_{std::move(counter)} {}
+        std::shared_ptr<Counter> counter_;
+    };
+
+    /**
+     * @brief 构造函数，立即启动工作线程
+     * @param worker_count 工作线程数量，0 表示使用 硬件线程数 - 1（至少 1 个）
+     */
+    explicit JobSystem(unsigned int worker_count = 0);
+    ~JobSystem();                                   ///< @brief 等待已入队的任务执行完毕后停止所有工作线程
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+    JobSystem(JobSystem&&) = delete;
+    JobSystem& operator=(JobSystem&&) = delete;
+
+    /**
+     * @brief 提交一个任务
+     * @param job 任务函数
+     * @param dependencies 依赖的任务，全部完成后 job 才会入队
+     * @return JobHandle 任务句柄
+     */
+    JobHandle schedule(std::function<void()> job, std::initializer_list<JobHandle> dependencies = {});
+
+    /// @brief 提交一个任务，依赖数量在运行时确定（例如按依赖图调度）
+    JobHandle schedule(std::function<void()> job, std::span<const JobHandle> dependencies);
+
+    /**
+     * @brief 把区间 [begin, end) 切分成若干块并行执行
+     * @param begin 起始下标
+     * @param end 结束下标（不包含）
+     * @param grain_size 每块的最小元素数（0 表示按工作线程数自动切分）
+     * @param body 处理一块的函数，参数为子区间 [first, last)
+     * @param dependencies 依赖的任务
+     * @return JobHandle 所有块完成后才视为完成
+     */
+    JobHandle parallel_for(std::size_t begin
+                         , std::size_t end
+                         , std::size_t grain_size
+                         , std::function<void(std::size_t, std::size_t)> body
+                         , std::initializer_list<JobHandle> dependencies = {});
+
+    /**
+     * @brief 等待任务完成，等待期间当前线程会帮忙执行其他任务
+     * @note 任务抛出的第一个异常会在这里重新抛出
+     */
+    void wait(const JobHandle& handle);
+
+    std::size_t get_worker_count() const { return workers_.size(); }   ///< @brief 获取工作线程数量
+
+private:
+    struct Job {
+        std::function<void()> func;
+        std::shared_ptr<Counter> counter;           ///< @brief 完成时递减的计数器
+    };
+
+    /// @brief 每个工作线程的任务队列
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    void worker_loop(std::size_t index);
+    void submit(std::vector<Job> jobs, std::span<const JobHandle> dependencies);        ///< @brief 依赖全部完成后把 jobs 入队
+    void enqueue(Job job);                          ///< @brief 放入当前线程的队列（非工作线程轮流放入各队列）
+    bool try_run_one(std::size_t preferred);        ///< @brief 取出（或窃取）并执行一个任务，没有任务时返回 false
+    void finish(Job& job);                          ///< @brief 任务完成后递减计数器，并触发依赖它的任务
+
+    /// @brief 在 counter 完成后执行 continuation（已完成则立即执行）
+    void when_done(const std::shared_ptr<Counter>& counter, std::function<void()> continuation);
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;  ///< @brief 各工作线程的队列
+    std::vector<std::jthread> workers_;                 ///< @brief 工作线程
+    std::atomic<std::size_t> next_queue_ = 0;           ///< @brief 非工作线程提交任务时轮流选择的队列
+    std::atomic<std::size_t> queued_jobs_ = 0;          ///< @brief 所有队列中的任务总数
+
+    std::mutex sleep_mutex_;                            ///< @brief 空闲线程休眠用
+    std::condition_variable sleep_cv_;
+    bool stopping_ = false;                             ///< @brief 是否正在停止（受 sleep_mutex_ 保护）
+};
+} // namespace engine::core
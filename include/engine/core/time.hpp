@@ -27,13 +27,36 @@ public:
 
     /**
      * @brief 设置时间缩放因子
+     * @note 缩放的是累加的真实时间，固定步长本身保持不变（多次调用不会叠加）
      */
     void set_time_scale(float scale);
 
     /**
      * @brief 获取时间缩放因子
      */
-    float get_time_scale();
+    float get_time_scale() const;
+
+    /**
+     * @brief 设置快进倍率（1/2/4/8），每个渲染帧执行相应倍数的固定步长更新
+     * @note 非 2 的幂或超出范围的值会被截断到最近的有效倍率
+     */
+    void set_fast_forward(unsigned int speed);
+
+    /**
+     * @brief 获取当前快进倍率
+     */
+    unsigned int get_fast_forward() const;
+
+    /**
+     * @brief 切换到下一档快进倍率（1 -> 2 -> 4 -> 8 -> 1）
+     */
+    void cycle_fast_forward();
+
+    /**
+     * @brief 报告本帧固定步长更新实际消耗的真实时间
+     * @note 快进时如果连续几帧都超出帧预算，会自动降一档，避免画面卡顿
+     */
+    void report_update_cost(sf::Time cost);
 
     /**
      * @brief 设置目标帧率
@@ -46,13 +69,30 @@ public:
     float get_target_fps() const;
 
     /**
-     * @brief 累加时间
+     * @brief 设置每帧最多执行的固定步长更新次数（0 表示不限制）
+     * @note 用于防止“死亡螺旋”：一次长时间卡顿（加载资源、拖动窗口）后不会连续追赶大量更新
+     */
+    void set_max_updates_per_frame(unsigned int max_updates);
+
+    /**
+     * @brief 获取每帧最多执行的固定步长更新次数
+     */
+    unsigned int get_max_updates_per_frame() const;
+
+    /**
+     * @brief 设置达到更新上限后剩余时间的处理方式
+     * @param carry_over true 保留到下一帧继续追赶；false 直接丢弃（模拟时间变慢，但不会越积越多）
+     */
+    void set_carry_over_lag(bool carry_over);
+
+    /**
+     * @brief 累加时间（同时开始新一帧的更新计数）
      */
     void accumulate_frame_time();
 
     /**
      * @brief 是否要更新游戏逻辑
-     * @return 如果time_since_last_update > time_per_frame返回真
+     * @return 如果累计时间不少于一个帧间隔且本帧未达到更新上限返回真
      */
     bool should_update() const;
 
@@ -60,6 +100,12 @@ public:
      * @brief 减少一单位帧间隔的时间
      */
     void consume_update_time();
+
+    /**
+     * @brief 获取渲染插值系数 elapsed_time / time_per_frame，范围 [0, 1]
+     * @note 渲染组件可以用它在上一次和当前的变换之间插值，使低频模拟也能平滑显示
+     */
+    float get_interpolation_alpha() const;
     
 private:
     float TAEGET_FPS = 60.f;                                    // 目标帧率
@@ -68,5 +114,10 @@ private:
     sf::Time elapsed_time = sf::Time::Zero;                     // 自上次更新以来的时间
     sf::Time time_per_frame_ = sf::Time::Zero;                  // 目标帧间隔
     float time_scale_ = 1.f;                                    // 时间缩放因子
+    unsigned int fast_forward_ = 1;                             // 快进倍率
+    unsigned int over_budget_frames_ = 0;                       // 连续超出帧预算的帧数
+    unsigned int max_updates_per_frame_ = 5;                    // 每帧最多更新次数（0 表示不限制）
+    unsigned int updates_this_frame_ = 0;                       // 本帧已执行的更新次数
+    bool carry_over_lag_ = false;                               // 达到上限后是否保留剩余时间
 };
 } // namespace engine::core
\ No newline at end of file
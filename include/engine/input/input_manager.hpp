@@ -48,7 +48,13 @@ public:
     
     sf::Vector2i get_mouse_position() const;            ///< @brief 获取鼠标位置（屏幕坐标）
     sf::Vector2i get_mouse_position_window() const;     ///< @brief 获取鼠标位置（窗口坐标）
-    sf::Vector2i get_mouse_logical_position() const;    ///< @brief 获取鼠标逻辑坐标（窗口坐标，考虑 view 缩放）
+    sf::Vector2i get_mouse_logical_position() const;    ///< @brief 获取鼠标逻辑坐标（窗口坐标，考虑 view 缩放；不访问窗口，可以在模拟线程调用）
+
+    /// @brief 设置鼠标逻辑坐标换算所用的视图大小（由主线程在模拟线程空闲时设置）
+    void set_logical_size(sf::Vector2f logical_size) { logical_size_ = logical_size; }
+
+    /// @brief 设置是否处于输入回放模式：回放时鼠标位置取自回放的事件，而不是真实鼠标
+    void set_replaying(bool replaying) { replaying_ = replaying; }
 
     void begin_frame();
     void end_frame();
@@ -60,7 +66,7 @@ private:
 
     void toggle_fullscreen();
 
-    sf::RenderWindow* window_obs_ = nullptr;        ///< @brief 用于传入获取鼠标的逻辑位置
+    sf::RenderWindow* window_obs_ = nullptr;        ///< @brief 用于传入获取鼠标的逻辑位置（无头模式下为空）
     /**
      * @brief 核心数据结构：存储动作名称函数列表的映射
      * 
@@ -75,6 +81,10 @@ private:
 
     bool should_quit_ = false;           ///< @brief 退出标志
     bool is_full_screen_ = false;        ///< @brief 是否全屏
+    bool replaying_ = false;             ///< @brief 是否处于输入回放模式
+    sf::Vector2i last_event_mouse_position_ = {0, 0};  ///< @brief 最近一次鼠标事件中的位置（窗口坐标）
+    sf::Vector2u window_size_;                          ///< @brief 窗口大小的副本（随 Resized 事件更新），换算逻辑坐标时不读取窗口
+    sf::Vector2f logical_size_;                         ///< @brief 视图大小的副本，换算逻辑坐标时不读取窗口
 };
 } // namespace engine::input
 
@@ -0,0 +1,102 @@
+#pragma once
+#include <SFML/Window/Event.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace engine::input {
+/**
+ * @brief 输入录制文件格式（小端，全部使用 LEB128 变长整数）
+ *
+ * 文件头：魔数 "MWIR"、版本号、固定步长（微秒）。
+ * 之后每个渲染帧一条记录：帧开始时的 tick 与上一帧的差值、事件数量、事件数据。
+ * 空闲帧只占 2 字节；事件只保存回放需要的字段（类型 + 按键/按钮/坐标等）。
+ */
+namespace replay_format {
+    inline constexpr char MAGIC[4] = {'M', 'W', 'I', 'R'};
+    inline constexpr std::uint32_t VERSION = 1;
+} // namespace replay_format
+
+/**
+ * @brief 录制传给 InputManager::handle_event 的所有事件及其所在的固定步长 tick
+ *
+ * 数据在内存中即以编码后的形式保存，save_to_file 时一次写出。
+ */
+class InputRecorder final {
+public:
+    /**
+     * @brief 构造函数
+     * @param fixed_step_us 录制时的固定步长（微秒），回放时用于校验
+     */
+    explicit InputRecorder(std::int64_t fixed_step_us);
+
+    /**
+     * @brief 开始新的一帧（会先写出上一帧）
+     * @param tick 本帧开始时已经执行的固定步长更新次数
+     */
+    void begin_frame(std::uint64_t tick);
+
+    /**
+     * @brief 记录一个事件（不影响回放的事件类型会被忽略）
+     */
+    void record(const sf::Event& event);
+
+    /**
+     * @brief 写出所有数据到文件
+     * @param final_tick 录制结束时的 tick，回放需要用它确定最后一帧执行的更新次数
+     */
+    bool save_to_file(std::string_view filepath, std::uint64_t final_tick);
+
+    std::size_t get_frame_count() const { return frame_count_; }      ///< @brief 已录制的帧数
+
+private:
+    void flush_frame();
+
+    std::vector<std::uint8_t> data_;                    ///< @brief 已编码的数据（不含文件头）
+    std::vector<sf::Event> pending_events_;             ///< @brief 当前帧尚未写出的事件
+    std::int64_t fixed_step_us_ = 0;                    ///< @brief 固定步长（微秒）
+    std::uint64_t last_tick_ = 0;                       ///< @brief 上一帧的 tick（用于差分编码）
+    std::uint64_t current_tick_ = 0;                    ///< @brief 当前帧的 tick
+    std::size_t frame_count_ = 0;                       ///< @brief 已写出的帧数
+    bool has_frame_ = false;                            ///< @brief 是否已经开始过一帧
+};
+
+/**
+ * @brief 回放 InputRecorder 录制的文件
+ *
+ * 逐帧读出事件，并告知每一帧需要执行的固定步长更新次数，从而按录制时完全相同的帧结构重放。
+ */
+class InputPlayer final {
+public:
+    InputPlayer() = default;
+
+    bool load_from_file(std::string_view filepath);     ///< @brief 加载录制文件，失败返回 false
+
+    /**
+     * @brief 读出下一帧的事件
+     * @param events 输出：本帧的事件（会先清空）
+     * @return 没有更多帧时返回 false
+     */
+    bool next_frame(std::vector<sf::Event>& events);
+
+    /**
+     * @brief 当前帧（最近一次 next_frame 读出的帧）需要执行的固定步长更新次数
+     */
+    std::uint64_t get_frame_steps() const { return frame_steps_; }
+
+    bool is_finished() const { return finished_; }                         ///< @brief 是否已回放完所有帧
+    std::int64_t get_fixed_step_us() const { return fixed_step_us_; }      ///< @brief 录制时的固定步长（微秒）
+
+private:
+    bool read_header();
+
+    std::vector<std::uint8_t> data_;                    ///< @brief 文件内容
+    std::size_t cursor_ = 0;                            ///< @brief 读取位置
+    std::int64_t fixed_step_us_ = 0;                    ///< @brief 录制时的固定步长（微秒）
+    std::uint64_t frame_steps_ = 0;                     ///< @brief 当前帧需要执行的更新次数
+    std::uint64_t final_tick_ = 0;                      ///< @brief 录制结束时的 tick
+    std::uint64_t tick_ = 0;                            ///< @brief 当前帧开始时的 tick
+    bool finished_ = true;                              ///< @brief 是否已回放完
+};
+} // namespace engine::input
@@ -1,27 +1,57 @@
 #pragma once
 #include "engine/component/component.hpp"
+#include "engine/component/component_type_id.hpp"
+#include "engine/object/object_handle.hpp"
+#include "engine/object/object_registry.hpp"
+#include "entt/core/hashed_string.hpp"
 #include <spdlog/spdlog.h>
-#include <memory>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string>
-#include <unordered_map>
-#include <typeindex>            // 用于索引类型
 #include <utility>              // 用于完美转发
 
 namespace sf {
     class Time;
 } // namespace sf
 
+namespace engine::scene {
+    class Scene;
+} // namespace engine::scene
+
 namespace engine::object {
+class ObjectPool;
+
 /**
  * @brief 游戏对象类，负责管理游戏对象的组件
  * 
  * 该类管理游戏对象的组件，并提供添加、获取、检查和移除组件的功能
  * 他还提供更新和渲染游戏对象的方法
+ *
+ * 组件本身存放在场景的 entt::registry 中（每种组件类型一个连续的池），GameObject 只是一个实体的句柄。
+ * add_component/get_component 等接口保持不变，作为旧代码的兼容层；系统可以直接遍历 registry 的视图。
+ * 对象内部另有一张按组件类型 id 索引的内联指针表，兄弟组件之间的查找只是一次数组访问。
  */
 class GameObject final {
+    friend class engine::scene::Scene;      ///< @brief 场景负责维护 scene_index_ 等索引信息
+    friend class engine::component::Component;  ///< @brief 组件开关阶段时通过对象通知场景
+    friend class ObjectPool;                    ///< @brief 对象池负责设置来源并在复用前重置对象
 public:
-    GameObject(std::string_view name = "", std::string_view tag = "");  ///< @brief 构造函数，默认名称为空，标签为空
-    ~GameObject() = default;
+    /**
+     * @brief 构造函数，在 registry 中创建对应的实体
+     * @param registry 组件所在的注册表（通常是场景的注册表，见 Scene::create_game_object），必须比对象活得更久
+     * @param name 名称
+     * @param tag 标签
+     */
+    explicit GameObject(ObjectRegistry& registry, std::string_view name = "", std::string_view tag = "");
+    ~GameObject();              ///< @brief 销毁实体及其所有组件
+
+    // 内存分配：默认在堆上，也可以放在场景的内存池中（见 Scene::create_game_object）
+    // 分配时在对象前记录来源，因此 std::unique_ptr<GameObject> 的默认删除器对两种来源都适用
+    static void* operator new(std::size_t size);
+    static void* operator new(std::size_t size, engine::utils::Arena& arena);
+    static void operator delete(void* ptr, std::size_t size) noexcept;
+    static void operator delete(void* ptr, engine::utils::Arena& arena) noexcept;   ///< @brief 仅在构造函数抛出异常时由编译器调用
 
     // 禁止拷贝和移动，确保唯一性 (通常游戏对象不应随意拷贝)
     GameObject(const GameObject&) = delete;
@@ -29,15 +59,25 @@ public:
     GameObject(GameObject&&) = delete;
     GameObject& operator=(GameObject&&) = delete;
 
+    /// @brief 把名称/标签字符串转换为 id（与 entt::hashed_string 相同，可用 "enemy"_hs 在编译期得到）
+    static entt::id_type to_id(std::string_view str) { return entt::hashed_string::value(str.data(), str.size()); }
+
     // setters and getters
-    void set_name(std::string_view name) { name_ = name; }                    ///< @brief 设置名称
-    void set_tag(std::string_view tag) { tag_ = tag; }                        ///< @brief 设置标签
-    void set_need_remove(bool need_remove) { need_remove_ = need_remove; }    ///< @brief 设置是否需要删除
+    void set_name(std::string_view name);                                     ///< @brief 设置名称（同步更新所在场景的名称索引）
+    void set_tag(std::string_view tag);                                       ///< @brief 设置标签（同步更新所在场景的标签分组）
+    void set_need_remove(bool need_remove);                                   ///< @brief 设置是否需要删除（同步 PendingRemoval 标记）
     std::string_view get_name() const { return name_; }                       ///< @brief 获取名称
     std::string_view get_tag() const { return tag_; }                         ///< @brief 获取标签
+    entt::id_type get_name_id() const { return name_id_; }                    ///< @brief 获取名称 id
+    entt::id_type get_tag_id() const { return tag_id_; }                      ///< @brief 获取标签 id
     bool is_need_remove() const { return need_remove_; }                      ///< @brief 获取是否需要删除
+    ObjectPool* get_pool() const { return pool_obs_; }                        ///< @brief 获取来源对象池（不是池化对象时为空）
+    engine::scene::Scene* get_scene() const { return scene_obs_; }            ///< @brief 获取所在的场景（不在场景中时为空）
+    entt::entity get_entity() const { return entity_; }                       ///< @brief 获取对应的实体
+    ObjectHandle get_handle() const { return ObjectHandle{entity_, registry_.get<ObjectLink>(entity_).generation}; }  ///< @brief 获取句柄（可长期保存，对象销毁或被对象池复用后自动失效）
+    ObjectRegistry& get_registry() const { return registry_; }                ///< @brief 获取组件所在的注册表
     
-    // 关键循环函数
+    // 关键循环函数（只调用参与对应阶段的组件；在场景中时由场景按阶段活动列表统一调用，不经过这里）
     void handle_input(engine::core::Context& context);                        ///< @brief 处理输入
     void update(sf::Time delta, engine::core::Context& context);              ///< @brief 更新所有组件
     void render(engine::core::Context& context);                              ///< @brief 渲染所有组件
@@ -53,19 +93,25 @@ public:
     template <typename T, typename... Args>
     T* add_component(Args&&... args) {
         static_assert(std::is_base_of<engine::component::Component, T>::value, "T 必须继承自 Component");
-        auto type_index = std::type_index(typeid(T));
+        const auto type_id = engine::component::component_type_id<T>();
+        if (type_id == engine::component::INVALID_COMPONENT_TYPE) {
+            return nullptr;
+        }
 
         // 如果组件存在，直接返回组件指针
-        if (has_component<T>()) {
-            return get_component<T>();
+        if (auto* existing = components_[type_id]; existing) {
+            return static_cast<T*>(existing);
         }
 
-        // 如果不存在就创建组件 记得把this传入！
-        auto new_component = std::make_unique<T>(this, std::forward<Args>(args)...);
-        T* ptr = new_component.get();
-        components_[type_index] = std::move(new_component);
+        // 如果不存在就在注册表的组件池中原地构造 记得把this传入！
+        // 组件不可移动，EnTT 会对其使用原地删除策略，指针在组件被移除前保持稳定
+        T& component = registry_.emplace<T>(entity_, this, std::forward<Args>(args)...);
+        component.type_id_ = type_id;
+        components_[type_id] = &component;
+        component_order_[component_count_++] = type_id;
+        on_component_added(&component);
         spdlog::debug("GameObject::add_component: {} added component {}", name_, typeid(T).name());
-        return ptr;
+        return &component;
     }
 
     /**
@@ -77,11 +123,9 @@ public:
     template <typename T>
     T* get_component() const {
         static_assert(std::is_base_of<engine::component::Component, T>::value, "T 必须继承自 Component");
-        auto type_index = std::type_index(typeid(T));
-        if (auto it = components_.find(type_index); it != components_.end()) {
-            return static_cast<T*>(it->second.get());
-        }
-        return nullptr;
+        const auto type_id = engine::component::component_type_id<T>();
+        if (type_id == engine::component::INVALID_COMPONENT_TYPE) return nullptr;
+        return static_cast<T*>(components_[type_id]);
     }
     
     /**
@@ -93,7 +137,7 @@ public:
     template <typename T>
     bool has_component() const {
         static_assert(std::is_base_of<engine::component::Component, T>::value, "T 必须继承自 Component");
-        return components_.contains(std::type_index(typeid(T)));
+        return get_component<T>() != nullptr;
     }
 
     /**
@@ -104,16 +148,38 @@ public:
     template<typename T>
     void remove_component() {
         static_assert(std::is_base_of<engine::component::Component, T>::value, "T 必须继承自 Component");
-        auto type_index = std::type_index(typeid(T));
-        if (auto it = components_.find(type_index); it != components_.end()) {
-            components_.erase(it);
+        const auto type_id = engine::component::component_type_id<T>();
+        if (type_id == engine::component::INVALID_COMPONENT_TYPE || !components_[type_id]) {
+            return;
         }
+        on_component_removed(components_[type_id]);
+        components_[type_id] = nullptr;
+        erase_from_order(type_id);
+        registry_.remove<T>(entity_);
     }
 
 private:
+    static constexpr std::size_t NOT_IN_SCENE = static_cast<std::size_t>(-1);
+
+    void erase_from_order(engine::component::ComponentTypeId type_id);     ///< @brief 从添加顺序表中移除一个类型 id
+    void on_component_added(engine::component::Component* component);     ///< @brief 在场景中时，把新组件加入场景的活动列表
+    void on_component_removed(engine::component::Component* component);   ///< @brief 在场景中时，把组件移出场景的活动列表
+    void on_component_tick_changed(engine::component::Component* component);   ///< @brief 组件开关阶段后同步场景的活动列表
+    void reset_components();                                                ///< @brief 按添加顺序重置所有组件的运行时状态
+
+    ObjectRegistry& registry_;  ///< @brief 组件所在的注册表
+    entt::entity entity_;       ///< @brief 对应的实体
     std::string name_;          ///< @brief 名称
     std::string tag_;           ///< @brief 标签
-    std::unordered_map<std::type_index, std::unique_ptr<engine::component::Component>> components_;     ///< @brief 组件列表
+    entt::id_type name_id_;     ///< @brief 名称 id（哈希）
+    entt::id_type tag_id_;      ///< @brief 标签 id（哈希）
+    std::array<engine::component::Component*, engine::component::MAX_COMPONENT_TYPES> components_{};       ///< @brief 按组件类型 id 索引的组件指针（组件本身存放在注册表中）
+    std::array<engine::component::ComponentTypeId, engine::component::MAX_COMPONENT_TYPES> component_order_{}; ///< @brief 组件的添加顺序，用于按顺序调用组件的虚函数
+    std::uint8_t component_count_ = 0;  ///< @brief 已添加的组件数量
+    engine::scene::Scene* scene_obs_ = nullptr; ///< @brief 所在的场景（加入场景后由场景设置）
+    ObjectPool* pool_obs_ = nullptr;            ///< @brief 来源对象池，离开场景时归还给它而不是销毁
+    std::size_t scene_index_ = NOT_IN_SCENE;    ///< @brief 在场景对象容器中的下标（用于 O(1) 移除）
+    std::size_t tag_index_ = NOT_IN_SCENE;      ///< @brief 在场景标签分组中的下标（用于 O(1) 移除）
     bool need_remove_ = false;  ///< @brief 延迟删除的标识，将由场景类负责管理
 };
 } // namespace engine::object
\ No newline at end of file
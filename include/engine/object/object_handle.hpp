@@ -0,0 +1,30 @@
+#pragma once
+#include "entt/entity/entity.hpp"
+#include <cstdint>
+
+namespace engine::object {
+/**
+ * @brief 场景中游戏对象的句柄（实体下标 + 版本号 + 对象代数）
+ *
+ * 对象销毁后实体的版本号会改变，旧句柄随之失效，因此可以长期保存（例如投射物或 AI 记录的目标），
+ * 通过 Scene::is_alive / Scene::resolve 在 O(1) 内检查目标是否仍然存在。
+ * 对象池复用对象时实体不变，但 ObjectLink 中的代数会加一，复用前取得的旧句柄同样失效。
+ * @note 句柄只在创建它的场景中有意义。
+ */
+class ObjectHandle final {
+public:
+    ObjectHandle() = default;                                                   ///< @brief 空句柄
+    explicit ObjectHandle(entt::entity entity, std::uint32_t generation = 0) : entity_{entity}, generation_{generation} {}
+
+    entt::entity get_entity() const { return entity_; }                         ///< @brief 获取对应的实体
+    std::uint32_t get_generation() const { return generation_; }                ///< @brief 获取对象代数（见 ObjectLink::generation）
+    bool is_null() const { return entity_ == entt::null; }                      ///< @brief 是否为空句柄
+    explicit operator bool() const { return !is_null(); }
+
+    bool operator==(const ObjectHandle& other) const = default;
+
+private:
+    entt::entity entity_ = entt::null;      ///< @brief 对应的实体（包含版本号）
+    std::uint32_t generation_ = 0;          ///< @brief 取得句柄时对象的代数
+};
+} // namespace engine::object
@@ -0,0 +1,76 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace engine::object {
+class GameObject;
+
+/**
+ * @brief 回收完整构建好的游戏对象的对象池
+ *
+ * 池中的对象保留所有组件：从池中取出时只把组件恢复到构造时的状态（Component::reset），
+ * 再调用可选的 Reset 函数恢复组件之外的状态（例如按蓝图恢复名称与标签），
+ * 不再重新分配对象、创建实体和构造组件。由 acquire 取出的对象离开场景时（被标记移除或直接移除），
+ * 场景会把它归还给来源对象池而不是销毁。
+ * 闲置对象仍带有 PendingRemoval 标记，因此系统不会处理它们。
+ * @note 对象池必须与生成对象的场景属于同一场景（对象的组件在场景的注册表中），
+ *       并且必须比池中取出的对象活得更久（通常作为场景派生类的成员）。
+ */
+class ObjectPool final {
+public:
+    using Factory = std::function<std::unique_ptr<GameObject>()>;   ///< @brief 创建一个新对象（未命中时调用）
+    using Reset = std::function<void(GameObject&)>;                 ///< @brief 把复用的对象恢复到工厂创建时的状态（组件重置之后调用）
+
+    /// @brief 对象池统计
+    struct Stats {
+        std::uint64_t hits = 0;             ///< @brief 从闲置对象中取出的次数
+        std::uint64_t misses = 0;           ///< @brief 没有闲置对象而新建的次数
+        std::uint64_t releases = 0;         ///< @brief 归还次数
+        std::size_t created = 0;            ///< @brief 累计创建的对象数（包括预热）
+        std::size_t idle = 0;               ///< @brief 当前闲置的对象数
+        std::size_t peak_in_use = 0;        ///< @brief 同时在使用中的对象数的峰值
+    };
+
+    /**
+     * @brief 构造函数
+     * @param name 名称（用于日志与统计）
+     * @param factory 创建新对象的函数
+     * @param reset 复用对象时恢复组件之外状态的函数（可以为空）
+     */
+    ObjectPool(std::string_view name, Factory factory, Reset reset = {});
+    ~ObjectPool();          ///< @brief 销毁所有闲置对象
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+    ObjectPool(ObjectPool&&) = delete;
+    ObjectPool& operator=(ObjectPool&&) = delete;
+
+    /// @brief 取出一个对象（已重置，未加入场景），优先复用闲置对象
+    std::unique_ptr<GameObject> acquire();
+
+    /// @brief 归还一个对象（通常由场景在对象离开时调用）
+    void release(std::unique_ptr<GameObject> object);
+
+    /// @brief 预先创建对象，直到闲置对象数达到 count
+    void warm_up(std::size_t count);
+
+    std::string_view get_name() const { return name_; }        ///< @brief 获取名称
+    const Stats& get_stats() const { return stats_; }           ///< @brief 获取统计
+    float get_hit_rate() const;                                 ///< @brief 命中率（没有取出过时为 1）
+
+private:
+    std::unique_ptr<GameObject> create();                       ///< @brief 通过工厂创建并标记来源
+
+    std::string name_;                                          ///< @brief 名称
+    Factory factory_;                                           ///< @brief 创建新对象的函数
+    Reset reset_;                                               ///< @brief 复用对象时恢复组件之外状态的函数
+    std::vector<std::unique_ptr<GameObject>> idle_;             ///< @brief 闲置对象（后进先出，最近归还的缓存最热）
+    std::size_t in_use_ = 0;                                    ///< @brief 当前在使用中的对象数
+    Stats stats_;                                               ///< @brief 统计
+};
+} // namespace engine::object
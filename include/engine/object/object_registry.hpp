@@ -0,0 +1,25 @@
+#pragma once
+#include "engine/utils/arena.hpp"
+#include "entt/entity/registry.hpp"
+#include <cstdint>
+
+namespace engine::object {
+/**
+ * @brief 存放游戏对象组件的注册表类型
+ *
+ * 与 entt::registry 相同，只是内存来自 ArenaAllocator：场景的注册表绑定场景的 Arena，
+ * 默认构造的 ObjectRegistry 则退化为普通的堆分配。
+ */
+using ObjectRegistry = entt::basic_registry<entt::entity, engine::utils::ArenaAllocator<entt::entity>>;
+
+class GameObject;
+
+/// @brief 实体到游戏对象的反向链接，每个 GameObject 的实体上都有一个（用于通过句柄找到对象）
+struct ObjectLink {
+    GameObject* object = nullptr;
+    std::uint32_t generation = 0;       ///< @brief 对象代数：对象池每次复用对象时加一，使复用前的句柄失效
+};
+
+/// @brief 标记组件：对象已被标记移除（本轮更新结束时销毁），系统可以用 entt::exclude 略过这些对象
+struct PendingRemoval {};
+} // namespace engine::object
@@ -19,28 +19,37 @@ namespace engine::render {
 /**
  * @brief 相机类负责管理相机位置和视口大小，并提供坐标转换功能。
  * 它还包含限制相机移动范围的边界。
+ * @note 相机只修改自己的视图，从不访问窗口：视图随绘制命令录制到快照中，由 Renderer 在提交时设置到窗口，
+ *       因此流水线模式下相机可以在模拟线程更新。
  */
 class Camera final {
 public:
     /**
-     * @brief 构造相机对象
-     * @param viewport_size 视口大小
-     * @param position 相机位置
+     * @brief 构造相机对象，视图取自窗口的默认视图
+     * @param window 窗口（只在构造时读取默认视图）
      * @param limit_bounds 限制相机的移动范围
      */
     Camera(sf::RenderWindow* window, std::optional<sf::FloatRect> limit_bounds = std::nullopt);
+
+    /**
+     * @brief 构造不依赖窗口的相机（无头模式）
+     * @param view_size 视口大小（逻辑分辨率）
+     * @param limit_bounds 限制相机的移动范围
+     */
+    explicit Camera(sf::Vector2f view_size, std::optional<sf::FloatRect> limit_bounds = std::nullopt);
     
-    void update(sf::Time delta_time);                                       ///< @brief 更新相机位置
-    void move(const sf::Vector2f& offset);                                  ///< @brief 移动相机
+    void update(sf::Time delta_time);                                       ///< @brief 固定步长更新：向跟随目标平滑移动
+    void interpolate(float alpha);                                          ///< @brief 渲染前把视图中心设为最近两次更新之间的插值（alpha 与精灵插值相同）
+    void move(const sf::Vector2f& offset);                                  ///< @brief 移动相机（瞬移，不插值）
 
     sf::Vector2f world_to_screen(const sf::Vector2f& world_pos) const;      ///< @brief 世界坐标转屏幕坐标
     sf::Vector2f world_to_screen_with_parallax(const sf::Vector2f& world_pos, const sf::Vector2f& scroll_factor) const; ///< 世界坐标转屏幕坐标，考虑视差滚动
     sf::Vector2f screen_to_world(const sf::Vector2f& screen_pos) const;     ///< @brief 屏幕坐标转世界坐标
 
-    void set_world_view_center(sf::Vector2f center);                        ///< @brief 设置世界摄像机中心
+    void set_world_view_center(sf::Vector2f center);                        ///< @brief 设置世界摄像机中心（瞬移，不插值）
     void set_ui_view_center(sf::Vector2f center);                           ///< @brief 设置ui摄像机中心
     void set_limit_bounds(std::optional<sf::FloatRect> limit_bounds);       ///< @brief 设置限制相机的移动范围
-    void set_target(engine::component::TransformComponent* target) { target_obs_ = target; }         ///< @brief 设置跟随目标变换组件
+    void set_target(engine::component::TransformComponent* target);                                  ///< @brief 设置跟随目标变换组件（从当前视图中心开始跟随）
 
     const sf::Vector2f get_world_view_center() const { return world_view_.getCenter(); }             ///< @brief 获取世界摄像机中心位置
     const sf::Vector2f get_ui_view_center() const { return ui_view_.getCenter(); }                   ///< @brief 获取ui摄像机中心位置
@@ -62,12 +71,14 @@ public:
 
 private:
     void clamp_position();                                          ///< @brief 限制相机位置在边界内
+    void snap_follow_center();                                      ///< @brief 把跟随状态重置为当前视图中心（瞬移后不再插值）
 
-    sf::RenderWindow* window_obs_;                                  ///< @brief 窗口的观察者指针，不管理其生命周期
     sf::View world_view_;                                           ///< @brief world（世界）摄像机
     sf::View ui_view_;                                              ///< @brief ui（界面）摄像机
     std::optional<sf::FloatRect> limit_bounds_;                     ///< @brief 限制相机的移动范围，空值表示不限制
     float smooth_speed_ = 5.f;                                      ///< @brief 相机移动的平滑速度
     engine::component::TransformComponent* target_obs_ = nullptr;   ///< @brief 跟随目标变换组件，空值表示不跟随
+    sf::Vector2f follow_center_;                                    ///< @brief 最近一次固定步长更新后的视图中心（跟随目标时）
+    sf::Vector2f previous_follow_center_;                           ///< @brief 上一次固定步长更新后的视图中心（用于渲染插值）
 };
 } // namespace engine::render
\ No newline at end of file
@@ -1,15 +1,22 @@
 #pragma once
 
 #include <SFML/System/Vector2.hpp>
+#include <SFML/Graphics/BlendMode.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Color.hpp>
+#include <cstddef>
+#include <memory>
 #include <string>
 #include <optional>
+#include <vector>
 
 namespace sf {
+    class RenderTexture;
     class RenderWindow;
     class Sprite;
     class Text;
+    class View;
+    class Font;
 } // namespace sf
 
 namespace engine::resource {
@@ -18,12 +25,18 @@ namespace engine::resource {
 
 namespace engine::render {
 class Camera;
+class RenderSnapshot;
 
 /**
  * @brief 封装 sfml 渲染操作
  *
  * 包装 sf::RenderWindow 并提供清除屏幕、绘制精灵和呈现最终图像的方法。
- * 在构造时初始化。依赖于一个有效的 sf::RenderWindow 和 ResourceManager。
+ * 在构造时初始化。依赖于一个有效的 ResourceManager。
+ * 无头模式下 window 为空，此时所有绘制调用都会被直接忽略。
+ * 录制模式下（begin_recording）绘制调用不会访问窗口，而是写入 RenderSnapshot，
+ * 之后由主线程通过 submit 提交，用于模拟线程与渲染线程的流水线。
+ * 直接绘制模式下绘制调用同样先写入内部快照，在 flush（或 display_frame）时才提交到窗口。
+ * 两种模式下精灵都按（视图、纹理、混合模式）合并为顶点批次，绘制调用数与连续批次数相当，而不是与精灵数相当。
  * 构造失败会抛出异常。
  */
 class Renderer final {
@@ -31,13 +44,21 @@ public:
     /**
      * @brief 构造函数
      *
-     * @param window 指向有效的 SDL_Renderer 的指针。不能为空。
+     * @param window 指向 sf::RenderWindow 的指针。为空表示无头模式（不绘制）。
      * @param resource_manager 指向有效的 ResourceManager 的指针。不能为空。
-     * @throws std::runtime_error 如果任一指针为 nullptr。
+     * @throws std::runtime_error 如果 resource_manager 为 nullptr。
      */
     Renderer(sf::RenderWindow* window, engine::resource::ResourceManager* resource_manager);
 
-    ~Renderer() = default;
+    ~Renderer();
+
+    /// @brief 最近一次提交的统计
+    struct SubmitStats {
+        std::size_t sprites = 0;        ///< @brief 提交的精灵数
+        std::size_t draw_calls = 0;     ///< @brief 窗口绘制调用数（精灵批次 + 文字 + 矩形）
+    };
+
+    bool is_headless() const { return window_obs_ == nullptr; }    ///< @brief 是否为无头模式（没有窗口）
 
     /**
      * @brief 清空当前帧
@@ -45,15 +66,50 @@ public:
     void clear_frame();
 
     /**
-     * @brief 显示当前绘制内容
+     * @brief 显示当前绘制内容（先提交尚未 flush 的绘制）
      */
     void display_frame();
 
     /**
-     * @brief 绘制一个精灵
+     * @brief 直接绘制模式下，把累积的绘制命令提交到窗口（场景渲染结束时调用）；录制模式下不做任何事
+     */
+    void flush();
+
+    /**
+     * @brief 开始录制：之后的绘制调用写入 snapshot 而不是窗口（snapshot 会先被清空）
+     * @param snapshot 录制目标，在 end_recording 之前必须保持有效
+     */
+    void begin_recording(RenderSnapshot& snapshot);
+
+    /**
+     * @brief 结束录制，恢复直接绘制到窗口
+     */
+    void end_recording();
+
+    bool is_recording() const { return recording_obs_ != nullptr; }    ///< @brief 是否处于录制模式
+
+    /**
+     * @brief 把录制好的快照绘制到窗口（只能在拥有窗口的主线程调用）
+     */
+    void submit(const RenderSnapshot& snapshot);
+
+    const SubmitStats& get_submit_stats() const { return submit_stats_; }  ///< @brief 获取最近一次提交的统计
+
+    /**
+     * @brief 延迟释放一个不再使用的渲染纹理（例如瓦片层的块缓存）
+     *
+     * 流水线模式下主线程可能正在提交引用该纹理的上一帧快照，不能立即释放：
+     * 纹理交给正在录制（或下一次录制）的快照持有，该快照的缓冲区下一次被录制时才释放，
+     * 此时引用过该纹理的快照都已提交。直接绘制模式下在下一次 flush 提交之后释放。
+     */
+    void retire_texture(std::unique_ptr<sf::RenderTexture> texture);
+
+    /**
+     * @brief 绘制一个精灵（写入批次，稍后提交）
      * @param sprite 包含纹理ID、源矩形和翻转状态的 Sprite 对象。
+     * @param blend 混合模式，不同的混合模式不会合并到同一批次
      */
-    void draw_sprite(const Camera& camera, sf::Sprite& sprite);
+    void draw_sprite(const Camera& camera, sf::Sprite& sprite, const sf::BlendMode& blend = sf::BlendAlpha);
 
     /**
      * @brief 绘制精灵考虑视差背景
@@ -65,10 +121,11 @@ public:
     );
     
     /**
-     * @brief 绘制ui精灵
+     * @brief 绘制ui精灵（写入批次，稍后提交）
      * @param sprite 要绘制的ui精灵
+     * @param blend 混合模式
      */
-    void draw_ui_sprite(const Camera& camera, sf::Sprite& sprite);
+    void draw_ui_sprite(const Camera& camera, sf::Sprite& sprite, const sf::BlendMode& blend = sf::BlendAlpha);
 
     /**
      * @brief 绘制文字
@@ -101,7 +158,22 @@ public:
     void draw_ui_filled_rect(const Camera& camera, const sf::FloatRect& rect, sf::Color color);
 
 private:
+    // --- 绘制出口：写入录制中的快照，或直接绘制模式下的内部快照 ---
+    RenderSnapshot& target() { return recording_obs_ ? *recording_obs_ : *immediate_; }
+    void emit_sprite(const sf::View& view, const sf::Sprite& sprite, const sf::BlendMode& blend = sf::BlendAlpha);
+    void emit_text(const sf::View& view, std::string_view str, const sf::Font& font, unsigned int font_size, sf::Vector2f position, sf::Color font_color);
+    void emit_rect(const sf::View& view, const sf::FloatRect& rect, sf::Color color);
+
+    /// @brief 是否需要处理绘制调用（有窗口或正在录制）
+    bool has_target() const { return window_obs_ || recording_obs_; }
+
+    void draw_text_now(std::string_view str, const sf::Font& font, unsigned int font_size, sf::Vector2f position, sf::Color font_color);
+
     sf::RenderWindow* window_obs_ = nullptr;                                    ///< @brief 窗口的观察者指针，不负责管理生命周期，不要在该类里手动释放他
     engine::resource::ResourceManager* resourec_manager_obs_ = nullptr;         ///< @brief 资源管理器的观察者指针，不负责管理生命周期，不要在该类里手动释放他
+    RenderSnapshot* recording_obs_ = nullptr;                                   ///< @brief 当前录制目标，为空表示直接绘制
+    std::unique_ptr<RenderSnapshot> immediate_;                                 ///< @brief 直接绘制模式下累积的命令（flush 时提交）
+    std::vector<std::unique_ptr<sf::RenderTexture>> retired_textures_;          ///< @brief 录制之外退役的渲染纹理（交给下一次录制的快照，或在 flush 后释放）
+    SubmitStats submit_stats_;                                                  ///< @brief 最近一次提交的统计
 };
 } // namespace engine::render
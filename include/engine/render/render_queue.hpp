@@ -0,0 +1,69 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace sf {
+    class Sprite;
+    class Texture;
+} // namespace sf
+
+namespace engine::render {
+class Camera;
+class Renderer;
+
+/// @brief 渲染层：层之间按顺序绘制，层内按 y 排序
+enum class RenderLayer : std::uint8_t {
+    Background,     ///< @brief 背景（视差层等）
+    Ground,         ///< @brief 地面瓦片层
+    Object,         ///< @brief 单位、敌人、建筑等（默认），y 越大越靠前；需要与单位交错遮挡的瓦片层（例如 fg_tile）也放在这一层
+    Foreground,     ///< @brief 始终遮挡所有对象的前景（例如树冠），层内按 y 排序
+    Effect,         ///< @brief 投射物与特效，始终在对象与前景之上
+};
+
+/**
+ * @brief 世界精灵的渲染队列：按（层、y、纹理）排序后提交给 Renderer
+ *
+ * 每个精灵的排序键打包为 64 位：高 8 位为层，中间 32 位为 y（浮点数转换为保序的无符号整数），
+ * 低 24 位为纹理编号（同一深度的精灵按纹理聚在一起，便于合并批次）。编号只需在一帧内稳定，随队列一起清空，
+ * 重新创建的纹理（例如瓦片层的区块）不会让映射表一直增长，也不会复用已释放纹理的旧地址对应的编号。
+ * 每帧用 LSD 基数排序（每趟 8 位），所有键在某个字节上都相同时跳过该趟，
+ * 代价与精灵数成线性关系；基数排序是稳定的，键相同的精灵保持入队顺序。
+ * @note 队列只保存精灵指针，入队的精灵在 submit 之前必须保持有效。
+ */
+class RenderQueue final {
+public:
+    /// @brief 队列中的一项
+    struct Item {
+        std::uint64_t key;              ///< @brief 排序键
+        sf::Sprite* sprite;             ///< @brief 要绘制的精灵
+    };
+
+    /**
+     * @brief 把精灵加入队列
+     * @param layer 渲染层
+     * @param sort_y 层内的排序依据（通常是对象脚下的世界 y 坐标）
+     * @param sprite 精灵（submit 之前必须保持有效）
+     */
+    void push(RenderLayer layer, float sort_y, sf::Sprite& sprite);
+
+    void sort();                                                    ///< @brief 按排序键稳定排序
+    void submit(Renderer& renderer, const Camera& camera);          ///< @brief 排序并按顺序绘制所有精灵，然后清空队列
+    void clear() { items_.clear(); texture_ids_.clear(); }          ///< @brief 清空队列与本帧的纹理编号（保留容量）
+
+    std::size_t size() const { return items_.size(); }              ///< @brief 获取队列中的精灵数
+    bool empty() const { return items_.empty(); }                   ///< @brief 队列是否为空
+    const std::vector<Item>& get_items() const { return items_; }   ///< @brief 获取队列内容（sort 之后为绘制顺序）
+
+    /// @brief 打包排序键（层 8 位 | y 32 位 | 纹理编号 24 位）
+    static std::uint64_t make_key(RenderLayer layer, float sort_y, std::uint32_t texture_id);
+
+private:
+    std::uint32_t get_texture_id(const sf::Texture* texture);      ///< @brief 纹理在本帧的紧凑编号（本帧首次出现时分配）
+
+    std::vector<Item> items_;                                           ///< @brief 本帧的精灵
+    std::vector<Item> scratch_;                                         ///< @brief 基数排序的辅助缓冲区（跨帧复用）
+    std::unordered_map<const sf::Texture*, std::uint32_t> texture_ids_; ///< @brief 纹理 -> 本帧的编号（clear 时清空）
+};
+} // namespace engine::render
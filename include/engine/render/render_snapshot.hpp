@@ -0,0 +1,113 @@
+#pragma once
+
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace sf {
+    class Font;
+    class RenderTexture;
+    class Sprite;
+    class Texture;
+} // namespace sf
+
+namespace engine::render {
+/**
+ * @brief 一帧的绘制命令快照
+ *
+ * 由 Renderer 生成：录制模式下在模拟线程生成、之后在主线程一次性提交给窗口；
+ * 直接绘制模式下 Renderer 也先写入内部的快照，在 flush 时提交。
+ * 快照只保存绘制所需的值（视图、顶点、文字、矩形），不再引用任何组件的实时状态，
+ * 因此模拟线程可以在主线程提交上一帧的同时继续更新下一帧。
+ * 精灵被展开为两个三角形写入共享的顶点缓冲；连续的、视图/纹理/混合模式都相同的精灵合并为一条批次命令，
+ * 提交时每个批次只需一次绘制调用。
+ * @note 快照只保存纹理和字体的裸指针。资源纹理和字体由 ResourceManager 持有，需保证在提交前不被卸载；
+ *       瓦片层块缓存等渲染纹理由组件持有，不再使用时通过 Renderer::retire_texture 交给之后录制的快照（retain），
+ *       直到引用它的快照都提交之后才释放。
+ */
+class RenderSnapshot final {
+public:
+    using ViewIndex = std::uint16_t;
+
+    static constexpr std::size_t VERTICES_PER_SPRITE = 6;      ///< @brief 每个精灵的顶点数（两个三角形）
+
+    /// @brief 一批精灵，顶点为 get_vertices 中 [first_vertex, first_vertex + vertex_count) 的三角形（视差背景在录制时已展开为多个精灵）
+    struct SpriteBatchCommand {
+        const sf::Texture* texture = nullptr;
+        sf::BlendMode blend = sf::BlendAlpha;
+        std::uint32_t first_vertex = 0;
+        std::uint32_t vertex_count = 0;
+        ViewIndex view = 0;
+    };
+
+    /// @brief 绘制一段带阴影的文字（sf::Text 在提交时才构建）
+    struct TextCommand {
+        std::string text;                       ///< @brief UTF-8 字符串
+        const sf::Font* font = nullptr;
+        unsigned int font_size = 0;
+        sf::Vector2f position;
+        sf::Color color = sf::Color::White;
+        ViewIndex view = 0;
+    };
+
+    /// @brief 绘制一个填充矩形
+    struct RectCommand {
+        sf::FloatRect rect;
+        sf::Color color;
+        ViewIndex view = 0;
+    };
+
+    using Command = std::variant<SpriteBatchCommand, TextCommand, RectCommand>;
+
+    RenderSnapshot();
+    ~RenderSnapshot();
+
+    // 快照体积可能较大，只允许移动
+    RenderSnapshot(const RenderSnapshot&) = delete;
+    RenderSnapshot& operator=(const RenderSnapshot&) = delete;
+    RenderSnapshot(RenderSnapshot&&);
+    RenderSnapshot& operator=(RenderSnapshot&&);
+
+    /// @brief 清空命令与顶点（保留容量，供下一帧复用），同时释放持有的退役纹理
+    void clear();
+
+    /// @brief 持有一个退役的渲染纹理，直到快照被清空或销毁（由 Renderer::retire_texture 调用）
+    void retain(std::unique_ptr<sf::RenderTexture> texture);
+
+    /**
+     * @brief 记录一个视图，与已记录的视图相同时直接复用
+     * @return ViewIndex 视图在快照中的下标
+     */
+    ViewIndex push_view(const sf::View& view);
+
+    void push(Command command) { commands_.push_back(std::move(command)); }    ///< @brief 追加一条绘制命令
+
+    /**
+     * @brief 追加一个精灵：按精灵的变换、纹理矩形和颜色写入顶点
+     *
+     * 上一条命令是视图、纹理、混合模式都相同的批次时直接并入该批次，否则开始一个新批次。
+     */
+    void push_sprite(const sf::Sprite& sprite, ViewIndex view, const sf::BlendMode& blend);
+
+    const std::vector<sf::View>& get_views() const { return views_; }          ///< @brief 获取记录的视图
+    const std::vector<Command>& get_commands() const { return commands_; }     ///< @brief 获取绘制命令（按绘制顺序）
+    const std::vector<sf::Vertex>& get_vertices() const { return vertices_; }  ///< @brief 获取所有批次共享的顶点
+    std::size_t get_sprite_count() const { return vertices_.size() / VERTICES_PER_SPRITE; }    ///< @brief 获取精灵数量
+    bool empty() const { return commands_.empty(); }                           ///< @brief 是否没有任何命令
+
+private:
+    std::vector<sf::View> views_;               ///< @brief 本帧用到的视图（通常只有世界视图和 UI 视图）
+    std::vector<Command> commands_;             ///< @brief 绘制命令
+    std::vector<sf::Vertex> vertices_;          ///< @brief 精灵批次的顶点（按批次连续存放）
+    std::vector<std::unique_ptr<sf::RenderTexture>> retired_textures_;  ///< @brief 延迟释放的渲染纹理
+};
+} // namespace engine::render
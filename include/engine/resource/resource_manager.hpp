@@ -1,18 +1,20 @@
 #pragma once
 
+#include "engine/resource/texture_atlas.hpp"
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
 #include <unordered_map>
 #include <memory>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace engine::resource {
 
 class ResourceManager final {
 public:
-    ResourceManager() = default;
-    ~ResourceManager() = default;
+    ResourceManager();
+    ~ResourceManager();
 
     ResourceManager(const ResourceManager&) = delete;
     ResourceManager& operator=(const ResourceManager&) = delete;
@@ -23,6 +25,18 @@ public:
     void unload_texture(std::string_view file);
     void clear_textures();
 
+    // --- Texture atlas ---
+    /**
+     * @brief 把图片打包进图集（启动时调用一次，之后 load_texture_region 会返回图集中的区域）
+     * @param sources 图片路径或目录（目录下的所有 .png，按文件名排序）
+     * @param page_size 图集页边长上限
+     * @return std::size_t 打包的图片数量
+     */
+    std::size_t build_texture_atlas(const std::vector<std::string>& sources, unsigned int page_size = TextureAtlas::DEFAULT_PAGE_SIZE);
+    /// @brief 获取图片所在的纹理与区域：已打包时返回图集页，否则按 load_texture 加载并返回整张纹理
+    TextureRegion load_texture_region(std::string_view file);
+    const TextureAtlas* get_texture_atlas() const { return texture_atlas_.get(); }     ///< @brief 获取图集，未构建时返回 nullptr
+
     // --- SoundBuffer ---
     sf::SoundBuffer* load_sound(std::string_view file);
     sf::SoundBuffer* get_sound(std::string_view file);
@@ -46,6 +60,7 @@ public:
 
 private:
     std::unordered_map<std::string, std::unique_ptr<sf::Texture>> textures_;
+    std::unique_ptr<TextureAtlas> texture_atlas_;
     std::unordered_map<std::string, std::unique_ptr<sf::SoundBuffer>> sounds_;
     std::unordered_map<std::string, std::unique_ptr<sf::Music>> musics_;
     std::unordered_map<std::string, std::unique_ptr<sf::Font>> fonts_;
@@ -0,0 +1,63 @@
+#pragma once
+#include <SFML/Graphics/Rect.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace sf {
+    class Texture;
+} // namespace sf
+
+namespace engine::resource {
+
+/// @brief 纹理中的一块区域：图集页纹理 + 原图在页中的位置（未打包的纹理则是整张纹理）
+struct TextureRegion {
+    const sf::Texture* texture = nullptr;   ///< @brief 纹理（由 ResourceManager 持有），加载失败时为空
+    sf::IntRect rect;                       ///< @brief 原图在纹理中的区域，原图中的坐标需加上 rect.position
+};
+
+/**
+ * @brief 启动时把多张小纹理打包成少数几张大纹理（图集页）
+ *
+ * 使用 ImGui 附带的 imstb_rectpack.h（skyline 算法）排布矩形，放不下的进入下一页。
+ * 同一页上的精灵共享纹理，可以被 Renderer 合并到同一个批次中绘制。
+ * 每张原图四周留出 PADDING 像素的透明间隔，避免采样时渗入相邻图片。
+ * 页的尺寸在打包后裁剪到实际用到的范围，超过页尺寸的图片不打包（仍作为独立纹理加载）。
+ */
+class TextureAtlas final {
+public:
+    static constexpr unsigned int DEFAULT_PAGE_SIZE = 8192;     ///< @brief 默认页边长（像素，受显卡最大纹理尺寸限制）
+    static constexpr unsigned int PADDING = 2;                  ///< @brief 图片之间的间隔（像素）
+
+    explicit TextureAtlas(unsigned int page_size = DEFAULT_PAGE_SIZE);
+    ~TextureAtlas();
+
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+    TextureAtlas(TextureAtlas&&) = delete;
+    TextureAtlas& operator=(TextureAtlas&&) = delete;
+
+    /**
+     * @brief 加载并打包图片，生成新的图集页（已打包的文件会被跳过）
+     * @param files 图片路径（同时作为查找时的键）
+     * @return std::size_t 本次打包的图片数量
+     */
+    std::size_t build(const std::vector<std::string>& files);
+
+    const TextureRegion* find(std::string_view file) const;     ///< @brief 查找图片所在的页与区域，未打包时返回 nullptr
+    void clear();                                               ///< @brief 释放所有页
+
+    unsigned int get_page_size() const { return page_size_; }                   ///< @brief 获取页边长上限
+    std::size_t get_page_count() const { return pages_.size(); }                ///< @brief 获取页数
+    std::size_t get_region_count() const { return regions_.size(); }            ///< @brief 获取已打包的图片数量
+
+private:
+    unsigned int page_size_;                                            ///< @brief 页边长上限
+    std::vector<std::unique_ptr<sf::Texture>> pages_;                   ///< @brief 图集页纹理
+    std::unordered_map<std::string, TextureRegion> regions_;            ///< @brief 图片路径 -> 所在页与区域
+};
+
+} // namespace engine::resource
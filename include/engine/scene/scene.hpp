@@ -1,8 +1,17 @@
 #pragma once
 #include "engine/ui/ui_manager.hpp"
+#include "engine/object/object_handle.hpp"
+#include "engine/object/object_registry.hpp"
+#include "engine/render/render_queue.hpp"
+#include "engine/spatial/spatial_grid.hpp"
+#include "engine/system/system_scheduler.hpp"
+#include "engine/utils/arena.hpp"
+#include "entt/core/fwd.hpp"
 #include <vector>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <array>
 #include <SFML/System/Time.hpp>
 
 namespace engine::core {
@@ -13,15 +22,36 @@ namespace engine::object {
     class GameObject;
 } // namespace engine::object
 
+namespace engine::component {
+    class Component;
+} // namespace engine::component
+
 namespace engine::scene {
 /**
  * @brief 场景基类，负责管理场景中的游戏对象和场景生命周期。
  *
  * 包含一组游戏对象，并提供更新、渲染、处理输入和清理的接口。
  * 派生类应实现具体的场景逻辑。
+ * 游戏对象的组件存放在场景的 entt::registry 中，系统（engine::system::System）按阶段线性遍历同类组件：
+ * 更新时先调用各阶段活动列表中的组件，再执行 Update 系统；渲染时先执行 PreRender 系统再绘制。
+ * 同一阶段的系统由 SystemScheduler 按组件读写依赖在工作线程上并行执行。
+ * 由 create_game_object 创建的对象、组件及注册表的内存都来自场景的 Arena，场景销毁时一次性释放。
+ * 从 ObjectPool 取出的对象离开场景时归还给对象池，场景销毁时则直接销毁。
+ * 带有 engine::spatial::SpatialIndexed 标记的对象由 SpatialIndexSystem 同步到场景的空间网格，用于范围查询。
+ * 精灵由 SpriteSyncSystem 登记到单独的精灵网格，渲染时只绘制与相机视口相交的精灵（视锥剔除）。
+ * 可见的精灵进入场景的渲染队列，按（渲染层、y、纹理）排序后绘制，使单位与建筑、前景按深度正确遮挡。
  */
 class Scene {
+    friend class engine::object::GameObject;   ///< @brief 对象改名/改标签时需要通知场景更新索引
 public:
+    static constexpr float SPRITE_GRID_CELL_SIZE = 256.f;      ///< @brief 精灵网格的格子边长（视口查询范围大，格子比范围查询用的网格更大）
+
+    /// @brief 最近一帧的精灵剔除统计
+    struct RenderStats {
+        std::size_t submitted = 0;      ///< @brief 与视口相交、提交绘制的精灵数
+        std::size_t culled = 0;         ///< @brief 在视口外被剔除的精灵数（不包括隐藏的精灵）
+    };
+
     /**
      * @brief 构造函数。
      *
@@ -43,24 +73,69 @@ public:
     virtual void render();                      ///< @brief 渲染场景。
     virtual void handle_input();                ///< @brief 处理输入。
 
+    /**
+     * @brief 创建一个组件存放在本场景注册表中的游戏对象（尚未加入场景，需再调用 add_game_object 或 safe_add_game_object）
+     * @note 对象的内存来自场景的内存池，不能比场景活得更久
+     * @param name 名称
+     * @param tag 标签
+     */
+    std::unique_ptr<engine::object::GameObject> create_game_object(std::string_view name = "", std::string_view tag = "");
+
     /// @brief 直接向场景中添加一个游戏对象。（初始化时可用，游戏进行中不安全） （&&表示右值引用，与std::move搭配使用，避免拷贝）
     virtual void add_game_object(std::unique_ptr<engine::object::GameObject>&& game_object);
 
     /// @brief 安全地添加游戏对象。（添加到pending_additions_中）
     virtual void safe_add_game_object(std::unique_ptr<engine::object::GameObject>&& game_object); 
 
-    /// @brief 直接从场景中移除一个游戏对象。（一般不使用，但保留实现的逻辑）
+    /// @brief 直接从场景中移除一个游戏对象，O(1)（一般不使用，游戏进行中不安全；会改变最后一个对象在容器中的位置）
     virtual void remove_game_object(engine::object::GameObject* game_object_ptr);
 
-    /// @brief 安全地移除游戏对象。（设置need_remove_标记）
+    /// @brief 安全地移除游戏对象。（设置need_remove_标记，本轮更新结束时统一移除）
     virtual void safe_remove_game_object(engine::object::GameObject* game_object_ptr);
 
+    /// @brief 通过句柄安全地移除游戏对象，句柄已失效时忽略
+    void safe_remove_game_object(engine::object::ObjectHandle handle);
+
+    /// @brief 句柄指向的对象是否仍然存在且未被标记移除，O(1)
+    bool is_alive(engine::object::ObjectHandle handle) const;
+
+    /// @brief 获取句柄指向的对象，对象已销毁或已被标记移除时返回 nullptr，O(1)
+    engine::object::GameObject* resolve(engine::object::ObjectHandle handle) const;
+
     /// @brief 获取场景中的游戏对象容器。
     const std::vector<std::unique_ptr<engine::object::GameObject>>& get_game_objects() const;
 
-    /// @brief 根据名称查找游戏对象（返回找到的第一个对象）。
+    /// @brief 根据名称查找游戏对象（返回找到的第一个对象），通过名称索引 O(1) 查找。
     engine::object::GameObject* find_game_object_by_name(std::string_view name) const;
 
+    /**
+     * @brief 根据名称 id 查找游戏对象（例如 "player"_hs），不比较字符串
+     * @note 场景中有多个不同名称的哈希值都等于 name_id 时无法区分，返回 nullptr（请改用字符串查找）
+     */
+    engine::object::GameObject* find_game_object_by_name(entt::id_type name_id) const;
+
+    /**
+     * @brief 获取带有指定标签的所有对象（不包括尚未加入场景的待添加对象）
+     * @note 被标记移除的对象在本轮更新结束前仍在分组中，调用方需检查 is_need_remove；
+     *       分组在添加/移除对象时会改变，遍历期间不要增删对象
+     */
+    const std::vector<engine::object::GameObject*>& get_game_objects_by_tag(std::string_view tag) const;
+
+    /**
+     * @brief 根据标签 id 获取对象分组（例如 "enemy"_hs），不比较字符串
+     * @note 场景中有多个不同标签的哈希值都等于 tag_id 时无法区分，返回空分组（请改用字符串查找）
+     */
+    const std::vector<engine::object::GameObject*>& get_game_objects_by_tag(entt::id_type tag_id) const;
+
+    /**
+     * @brief 添加一个系统，访问冲突的系统按添加顺序执行，其余系统可能并行
+     * @note 场景构造时已添加 SpatialIndexSystem、AnimationSystem、HealthSystem（Update）与 SpriteSyncSystem（PreRender）
+     */
+    void add_system(std::unique_ptr<engine::system::System> system, engine::system::SystemStage stage);
+
+    /// @brief 让所有变换的上一次位置等于当前位置，场景停止更新（被覆盖）时调用，避免静止的场景仍在插值中抖动
+    void settle_interpolation();
+
     /// @brief 请求弹出当前场景
     void request_pop_scene();
 
@@ -78,16 +153,78 @@ public:
     std::string_view get_name() const { return scene_name_; }                   ///< @brief 获取场景名称
 
     engine::core::Context& get_context() const { return context_; }                                         ///< @brief 获取上下文引用
+    engine::object::ObjectRegistry& get_registry() { return registry_; }                                    ///< @brief 获取组件注册表
+    const engine::object::ObjectRegistry& get_registry() const { return registry_; }                        ///< @brief 获取组件注册表
+    const engine::utils::Arena::Stats& get_arena_stats() const { return arena_.get_stats(); }               ///< @brief 获取场景内存池的使用统计
+    const engine::spatial::SpatialGrid& get_spatial_grid() const { return spatial_grid_; }                  ///< @brief 获取空间网格（只在 Update 系统之后、下一次更新之前与最新位置一致）
+    const RenderStats& get_render_stats() const { return render_stats_; }                                   ///< @brief 获取最近一帧的精灵剔除统计
+    engine::render::RenderQueue& get_render_queue() { return render_queue_; }                                ///< @brief 获取渲染队列（render 阶段的组件可把精灵加入其中，与对象一起排序）
     std::vector<std::unique_ptr<engine::object::GameObject>>& get_game_objects() { return game_objects_; }  ///< @brief 获取场景中的游戏对象
     
 protected:
     void process_pending_additions();                               ///< @brief 处理待添加的游戏对象。（每轮更新的最后调用）
+    void remove_dead_game_objects();                                ///< @brief 一次 swap-and-pop 压缩，移除所有被标记的对象。（每轮更新的最后调用）
+    void swap_and_pop(std::size_t index);                           ///< @brief 用最后一个对象覆盖 index 处的对象并弹出，O(1)（池化对象归还给对象池）
+
+    // --- 名称/标签索引 ---
+    void index_game_object(engine::object::GameObject* game_object);        ///< @brief 对象加入场景时建立索引
+    void unindex_game_object(engine::object::GameObject* game_object);      ///< @brief 对象离开场景时移除索引
+    void on_name_changed(engine::object::GameObject* game_object, entt::id_type old_name_id);
+    void on_tag_changed(engine::object::GameObject* game_object, entt::id_type old_tag_id);
+    void add_to_name_bucket(engine::object::GameObject* game_object);
+    void add_to_tag_bucket(engine::object::GameObject* game_object);
+    void remove_from_tag_bucket(engine::object::GameObject* game_object, entt::id_type tag_id);
+    void erase_name_entry(engine::object::GameObject* game_object, entt::id_type name_id);
+
+    // --- 各阶段的活动组件列表 ---
+    static constexpr std::size_t NOT_TICKING_PHASE = static_cast<std::size_t>(-1);  ///< @brief 没有正在遍历的阶段
+    void sync_component_ticks(engine::component::Component* component);    ///< @brief 按组件参与的阶段加入/移出各活动列表（幂等）
+    void untrack_component(engine::component::Component* component);       ///< @brief 把组件移出所有活动列表
+    void erase_tick_entry(std::size_t phase, engine::component::Component* component);  ///< @brief 把组件移出一个阶段的活动列表（Render 阶段保序；正在遍历的列表只置空）
+    void compact_tick_list(std::size_t phase);                              ///< @brief 保序删除遍历期间置空的条目并更新下标
+    /// @brief 遍历一个阶段的活动列表，遍历期间移出列表的组件在遍历结束后统一压缩
+    template <typename Fn>
+    void tick_phase(engine::utils::ComponentPhase phase, bool skip_removed, Fn&& fn);
+
+    /// @brief 对象被标记移除、实体销毁或去掉 SpatialIndexed / SpriteComponent 时把它移出空间网格与精灵网格（注册表信号回调）
+    void on_spatial_removal(engine::object::ObjectRegistry& registry, entt::entity entity);
+
+    /// @brief 同一名称（或标签）的对象分组
+    struct ObjectBucket {
+        std::string key;                                            ///< @brief 名称或标签字符串（区分哈希冲突）
+        std::vector<engine::object::GameObject*> objects;           ///< @brief 分组中的对象（无序）
+    };
+    /// @brief 字符串 id -> 分组链（通常只有一个分组，哈希冲突时每个字符串各一个分组）
+    using BucketMap = std::unordered_map<entt::id_type, std::vector<ObjectBucket>>;
+
+    /// @brief 获取 key 所在的分组，不存在时加入分组链（出现哈希冲突时输出警告）
+    ObjectBucket& bucket_for(BucketMap& buckets, entt::id_type id, std::string_view key, std::string_view kind);
+    /// @brief 查找字符串等于 key 的分组
+    static const ObjectBucket* find_bucket(const BucketMap& buckets, entt::id_type id, std::string_view key);
+    /// @brief 按 id 查找分组：只有一个非空分组时返回它，没有或有多个（哈希冲突）时返回 nullptr
+    static const ObjectBucket* find_unique_bucket(const BucketMap& buckets, entt::id_type id);
+    void store_previous_transforms();                               ///< @brief 记录所有变换的当前位置，用于渲染插值（每轮更新的开始调用）
+    void run_systems(engine::system::SystemStage stage, sf::Time delta);   ///< @brief 执行一个阶段的所有系统（每个系统单独计时）
+    void render_visible_sprites();                                  ///< @brief 查询精灵网格，把与相机视口相交的精灵加入渲染队列，排序后绘制，并更新剔除统计
 
     std::string scene_name_;                                        ///< @brief 场景名称
     engine::core::Context& context_;                                ///< @brief 上下文引用（显式，构造时传入）
+    engine::utils::Arena arena_;                                    ///< @brief 场景内存池（必须声明在注册表和游戏对象容器之前，确保最后析构）
+    engine::object::ObjectRegistry registry_;                       ///< @brief 组件注册表（必须声明在游戏对象容器之前，确保在它们之后析构）
     std::unique_ptr<engine::ui::UIManager> ui_manager_ = nullptr;   ///< @brief UI管理器(初始化时自动创建)
 
     std::vector<std::unique_ptr<engine::object::GameObject>> game_objects_;         ///< @brief 场景中的游戏对象
     std::vector<std::unique_ptr<engine::object::GameObject>> pending_additions_;    ///< @brief 待添加的游戏对象（延时添加）
+    BucketMap name_buckets_;                                                        ///< @brief 名称 id -> 对象分组（空分组即时删除）
+    BucketMap tag_buckets_;                                                         ///< @brief 标签 id -> 对象分组（空分组保留，避免反复分配）
+    std::array<std::vector<engine::component::Component*>, 3> tick_lists_;         ///< @brief 按 ComponentPhase 索引的活动组件列表（Render 阶段按加入顺序，即绘制顺序；其他阶段无序）
+    std::size_t ticking_phase_ = NOT_TICKING_PHASE;                                 ///< @brief 正在遍历的阶段（遍历期间该列表只置空不删除）
+    bool tick_list_dirty_ = false;                                                  ///< @brief 正在遍历的列表中是否有置空的条目
+    engine::spatial::SpatialGrid spatial_grid_;                                     ///< @brief 空间网格（必须声明在调度器之前，SpatialIndexSystem 持有它的引用）
+    engine::spatial::SpatialGrid sprite_grid_{SPRITE_GRID_CELL_SIZE};              ///< @brief 精灵网格，按包围盒登记（SpriteSyncSystem 持有它的引用）
+    std::vector<engine::object::GameObject*> visible_sprites_;                      ///< @brief 本帧可见的精灵所属对象（复用以避免每帧分配）
+    RenderStats render_stats_;                                                      ///< @brief 最近一帧的精灵剔除统计
+    engine::render::RenderQueue render_queue_;                                      ///< @brief 世界精灵的渲染队列（每帧排序后清空，保留容量）
+    std::array<engine::system::SystemScheduler, 2> schedulers_;                     ///< @brief 按 SystemStage 索引的系统调度器
 };
 } // namespace engine::scene
\ No newline at end of file
@@ -0,0 +1,149 @@
+#pragma once
+#include <entt/core/fwd.hpp>
+#include <entt/entity/entity.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::core {
+    class JobSystem;
+} // namespace engine::core
+
+namespace engine::object {
+    class GameObject;
+} // namespace engine::object
+
+namespace engine::spatial {
+inline constexpr entt::id_type ANY_TAG = 0;     ///< @brief 查询时不按标签过滤（GameObject::to_id 不会得到 0）
+
+/**
+ * @brief 标记组件：带有它的实体由 SpatialIndexSystem 按 TransformComponent 的位置加入场景的空间网格
+ *
+ * 同时作为网格的访问声明：同步网格的系统 writes<SpatialIndexed>，查询网格的系统 reads<SpatialIndexed>，
+ * 调度器据此保证查询发生在同步之后、且不与同步并行。
+ */
+struct SpatialIndexed {};
+
+/// @brief 批量圆形查询的一项
+struct CircleQuery {
+    sf::Vector2f center;                ///< @brief 圆心
+    float radius = 0.f;                 ///< @brief 半径
+    entt::id_type tag_id = ANY_TAG;     ///< @brief 只返回带有此标签的对象
+};
+
+/**
+ * @brief 均匀哈希网格，用于范围与邻近查询
+ *
+ * 世界按 cell_size 划分为正方形格子，只有存在对象的格子才会分配（哈希表，世界大小不受限）。
+ * 格子内直接存放位置、标签与对象指针，查询只访问与查询区域重叠的格子，
+ * 代价只与区域内的对象数有关，而不是与对象总数有关。
+ * 对象移动时只有跨越格子才需要在格子之间搬移，否则只是就地更新位置。
+ * 格子大小宜与最常见的查询半径相当（例如弓箭手的射程）。
+ * 对象也可以带有半尺寸（包围盒），用 query_overlapping 查询与矩形相交的对象（例如视锥剔除）。
+ * @note 查询是只读的，可以在多个线程上同时进行；修改（insert/update/remove）不能与查询并行。
+ */
+class SpatialGrid final {
+public:
+    static constexpr float DEFAULT_CELL_SIZE = 128.f;                   ///< @brief 默认格子边长（像素）
+    static constexpr std::size_t BATCH_GRAIN_SIZE = 16;                 ///< @brief 批量查询时每个任务处理的查询数
+
+    explicit SpatialGrid(float cell_size = DEFAULT_CELL_SIZE);
+
+    /**
+     * @brief 插入对象或更新其位置与标签（已存在时等同于 update）
+     * @param entity 对象的实体（作为网格中的键）
+     * @param object 对象指针（查询结果）
+     * @param position 世界坐标
+     * @param tag_id 标签 id
+     * @param half_extent 包围盒的半尺寸（position 为包围盒中心），只有 query_overlapping 使用
+     */
+    void update(entt::entity entity, engine::object::GameObject* object, sf::Vector2f position, entt::id_type tag_id, sf::Vector2f half_extent = {});
+    void remove(entt::entity entity);                       ///< @brief 移除对象，不存在时忽略
+    bool contains(entt::entity entity) const { return locations_.contains(entity); }   ///< @brief 对象是否在网格中
+    void clear();                                           ///< @brief 移除所有对象
+
+    /**
+     * @brief 查询圆内的对象（包含边界）
+     * @param out 输出，先被清空（调用方可复用以避免分配）
+     * @return std::size_t 找到的对象数量
+     */
+    std::size_t query_circle(sf::Vector2f center, float radius, std::vector<engine::object::GameObject*>& out, entt::id_type tag_id = ANY_TAG) const;
+
+    /// @brief 查询矩形内的对象（包含边界），out 先被清空
+    std::size_t query_rect(const sf::FloatRect& rect, std::vector<engine::object::GameObject*>& out, entt::id_type tag_id = ANY_TAG) const;
+
+    /**
+     * @brief 查询包围盒与矩形相交的对象，out 先被清空
+     *
+     * 对象只按中心登记在一个格子中，因此搜索范围按曾经登记过的最大半尺寸向外扩展。
+     */
+    std::size_t query_overlapping(const sf::FloatRect& rect, std::vector<engine::object::GameObject*>& out, entt::id_type tag_id = ANY_TAG) const;
+
+    /**
+     * @brief 查询距离最近的至多 k 个对象，按距离从近到远排列
+     *
+     * 从中心所在的格子开始一圈一圈向外搜索，已找到 k 个且更外圈不可能更近时停止。
+     * @param max_radius 只考虑此距离内的对象
+     * @param out 输出，先被清空
+     */
+    std::size_t query_nearest(sf::Vector2f center, std::size_t k, std::vector<engine::object::GameObject*>& out
+                            , float max_radius = std::numeric_limits<float>::infinity(), entt::id_type tag_id = ANY_TAG) const;
+
+    /// @brief 查询最近的一个对象，找不到时返回 nullptr
+    engine::object::GameObject* find_nearest(sf::Vector2f center, float max_radius = std::numeric_limits<float>::infinity(), entt::id_type tag_id = ANY_TAG) const;
+
+    /**
+     * @brief 批量圆形查询（例如所有防御塔一次性查询射程内的敌人）
+     * @param queries 查询列表
+     * @param results 输出，调整为与 queries 等长，results[i] 对应 queries[i]
+     * @param job_system 不为空且查询足够多时，按 BATCH_GRAIN_SIZE 切分到工作线程并行查询
+     */
+    void query_circles(std::span<const CircleQuery> queries, std::vector<std::vector<engine::object::GameObject*>>& results
+                     , engine::core::JobSystem* job_system = nullptr) const;
+
+    float get_cell_size() const { return cell_size_; }                  ///< @brief 获取格子边长
+    std::size_t size() const { return locations_.size(); }              ///< @brief 获取网格中的对象数量
+    std::size_t get_cell_count() const { return cells_.size(); }        ///< @brief 获取已分配的格子数量（包括已清空的格子）
+
+private:
+    /// @brief 格子中的一项（查询只需访问这里）
+    struct Item {
+        sf::Vector2f position;
+        sf::Vector2f half_extent;
+        entt::id_type tag_id;
+        entt::entity entity;
+        engine::object::GameObject* object;
+    };
+    using Cell = std::vector<Item>;
+
+    /// @brief 对象所在的位置（格子指针在哈希表中保持稳定）
+    struct Location {
+        std::uint64_t key;
+        Cell* cell;
+        std::size_t slot;
+    };
+
+    sf::Vector2i cell_coord(sf::Vector2f position) const;
+    static std::uint64_t cell_key(sf::Vector2i coord);
+    static sf::Vector2i key_coord(std::uint64_t key);
+    const Cell* find_cell(sf::Vector2i coord) const;
+    void erase_slot(Cell& cell, std::size_t slot);                  ///< @brief swap-and-pop 移除格子中的一项，并修正被移动项的位置
+
+    /// @brief 对矩形覆盖的每个非空格子调用 fn（覆盖的格子数多于已分配格子时改为遍历已分配格子）
+    template <typename Fn>
+    void for_each_cell(sf::Vector2i min, sf::Vector2i max, Fn&& fn) const;
+
+    float cell_size_;                                       ///< @brief 格子边长
+    float inv_cell_size_;                                   ///< @brief 1 / cell_size_
+    std::unordered_map<std::uint64_t, Cell> cells_;         ///< @brief 格子坐标 -> 格子中的对象（清空的格子保留，避免反复分配）
+    std::unordered_map<entt::entity, Location> locations_;  ///< @brief 实体 -> 所在格子与下标
+    sf::Vector2i min_coord_{};                              ///< @brief 曾经有对象的格子坐标下界（只扩大，用于限制最近邻搜索的圈数）
+    sf::Vector2i max_coord_{};                              ///< @brief 曾经有对象的格子坐标上界
+    sf::Vector2f max_half_extent_{};                        ///< @brief 曾经登记过的最大半尺寸（只扩大，用于扩展 query_overlapping 的搜索范围）
+};
+} // namespace engine::spatial
@@ -0,0 +1,15 @@
+#pragma once
+#include "system.hpp"
+
+namespace engine::system {
+/**
+ * @brief 推进所有 AnimationComponent 的播放，并把当前帧写入对应的精灵
+ * @note 略过已被标记移除的对象；一次性动画播放完毕后的对象移除通过延迟命令执行
+ */
+class AnimationSystem final : public System {
+public:
+    AnimationSystem();
+
+    void update(engine::object::ObjectRegistry& registry, sf::Time delta, engine::core::Context& context) override;
+};
+} // namespace engine::system
@@ -0,0 +1,15 @@
+#pragma once
+#include "system.hpp"
+
+namespace engine::system {
+/**
+ * @brief 推进所有 HealthComponent 的无敌计时器
+ * @note 略过已被标记移除的对象
+ */
+class HealthSystem final : public System {
+public:
+    HealthSystem();
+
+    void update(engine::object::ObjectRegistry& registry, sf::Time delta, engine::core::Context& context) override;
+};
+} // namespace engine::system
@@ -0,0 +1,25 @@
+#pragma once
+#include "system.hpp"
+
+namespace engine::spatial {
+    class SpatialGrid;
+} // namespace engine::spatial
+
+namespace engine::system {
+/**
+ * @brief 把带有 SpatialIndexed 标记的对象按 TransformComponent 的位置同步到空间网格
+ *
+ * 每次更新只插入新对象、更新已有对象的位置与标签；被标记移除的对象由场景在标记时从网格中移除。
+ * 查询网格的系统应声明 reads<engine::spatial::SpatialIndexed>，从而排在本系统之后。
+ * @note 组件在活动列表中更新时看到的是上一帧同步的位置。
+ */
+class SpatialIndexSystem final : public System {
+public:
+    explicit SpatialIndexSystem(engine::spatial::SpatialGrid& grid);
+
+    void update(engine::object::ObjectRegistry& registry, sf::Time delta, engine::core::Context& context) override;
+
+private:
+    engine::spatial::SpatialGrid& grid_;    ///< @brief 场景的空间网格
+};
+} // namespace engine::system
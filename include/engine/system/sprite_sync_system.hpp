@@ -0,0 +1,25 @@
+#pragma once
+#include "system.hpp"
+
+namespace engine::spatial {
+    class SpatialGrid;
+} // namespace engine::spatial
+
+namespace engine::system {
+/**
+ * @brief 渲染前把所有精灵同步到所属对象的（插值后的）变换，并按精灵的包围盒更新场景的精灵网格
+ *
+ * 同步完成后场景按相机视口查询精灵网格，只绘制可见的精灵。
+ * 没有 TransformComponent 的对象精灵保持原样（仍按当前包围盒登记）；
+ * 隐藏的精灵与尚未加入场景（仍在延时添加列表中）的对象不在网格中；被标记移除（或在对象池中闲置）的对象被略过。
+ */
+class SpriteSyncSystem final : public System {
+public:
+    explicit SpriteSyncSystem(engine::spatial::SpatialGrid& sprite_grid);
+
+    void update(engine::object::ObjectRegistry& registry, sf::Time delta, engine::core::Context& context) override;
+
+private:
+    engine::spatial::SpatialGrid& sprite_grid_;     ///< @brief 场景的精灵网格（只由本系统写入，通过 SpriteComponent 的写访问保护）
+};
+} // namespace engine::system
@@ -0,0 +1,97 @@
+#pragma once
+#include "engine/object/object_registry.hpp"
+#include "engine/utils/profiler.hpp"
+#include <entt/core/type_info.hpp>
+#include <SFML/System/Time.hpp>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace engine::core {
+    class Context;
+} // namespace engine::core
+
+namespace engine::system {
+/**
+ * @brief 系统执行的阶段
+ */
+enum class SystemStage {
+    Update,         ///< @brief 场景更新时，在组件活动列表之后执行
+    PreRender       ///< @brief 场景渲染时，在组件活动列表之前执行
+};
+
+/**
+ * @brief 系统基类：在一次遍历中处理注册表里某一类组件的全部实例
+ *
+ * 与逐对象调用组件的虚函数不同，系统通过 entt 视图线性遍历同类组件的连续存储，
+ * 对每个组件只调用非虚函数；每个系统拥有自己的计时区域，分析器可以按系统统计耗时。
+ *
+ * 派生类在构造函数中用 reads / writes 声明访问的组件类型，SystemScheduler 据此构建依赖图，
+ * 让互不冲突的系统在工作线程上并行执行。没有声明任何访问（或调用了 set_exclusive）的系统独占执行。
+ * update 可能在工作线程上调用：只能访问声明过的组件，其他副作用（删除对象、播放音效、修改场景等）
+ * 需通过 defer 延迟到所有系统执行完后，在主线程按系统添加顺序统一执行。
+ */
+class System {
+public:
+    explicit System(std::string_view name);
+    virtual ~System() = default;
+
+    System(const System&) = delete;
+    System& operator=(const System&) = delete;
+    System(System&&) = delete;
+    System& operator=(System&&) = delete;
+
+    /**
+     * @brief 执行一次系统遍历
+     * @param registry 场景的组件注册表
+     * @param delta 时间步长（PreRender 阶段为本帧的渲染间隔，不推进模拟）
+     * @param context 引擎上下文
+     */
+    virtual void update(engine::object::ObjectRegistry& registry, sf::Time delta, engine::core::Context& context) = 0;
+
+    /// @brief 创建声明过的组件存储（调度前在主线程调用，避免并行执行时注册表内部的存储表被修改）
+    void prepare(engine::object::ObjectRegistry& registry) const;
+
+    /// @brief 按记录顺序执行并清空延迟命令（所有系统执行完后在主线程调用）
+    void flush_deferred(engine::core::Context& context);
+
+    std::string_view get_name() const { return name_; }                             ///< @brief 获取系统名称
+    engine::utils::Profiler::ZoneId get_zone() const { return zone_; }              ///< @brief 获取系统的计时区域
+    const std::vector<entt::id_type>& get_reads() const { return reads_; }          ///< @brief 获取只读访问的组件类型
+    const std::vector<entt::id_type>& get_writes() const { return writes_; }        ///< @brief 获取读写访问的组件类型
+    bool is_exclusive() const { return exclusive_ || (reads_.empty() && writes_.empty()); }    ///< @brief 是否需要独占执行
+
+protected:
+    /// @brief 声明只读访问的组件类型（包括 entt::exclude 中的类型）
+    template <typename... T>
+    void reads() {
+        (reads_.push_back(entt::type_hash<T>::value()), ...);
+        (preparers_.push_back(&prepare_storage<T>), ...);
+    }
+
+    /// @brief 声明读写访问的组件类型
+    template <typename... T>
+    void writes() {
+        (writes_.push_back(entt::type_hash<T>::value()), ...);
+        (preparers_.push_back(&prepare_storage<T>), ...);
+    }
+
+    void set_exclusive(bool exclusive) { exclusive_ = exclusive; }  ///< @brief 设置是否独占执行（访问了组件以外的共享状态时使用）
+
+    /// @brief 记录一条延迟命令，在本阶段所有系统执行完后执行（可在工作线程上调用，但每个系统同一时间只在一个线程上运行）
+    void defer(std::function<void(engine::core::Context&)> command) { deferred_.push_back(std::move(command)); }
+
+private:
+    template <typename T>
+    static void prepare_storage(engine::object::ObjectRegistry& registry) { registry.storage<T>(); }
+
+    std::string name_;                          ///< @brief 系统名称（同时也是计时区域名称）
+    engine::utils::Profiler::ZoneId zone_;      ///< @brief 计时区域 id
+    std::vector<entt::id_type> reads_;          ///< @brief 只读访问的组件类型
+    std::vector<entt::id_type> writes_;         ///< @brief 读写访问的组件类型
+    std::vector<void (*)(engine::object::ObjectRegistry&)> preparers_;     ///< @brief 创建各组件存储的函数
+    std::vector<std::function<void(engine::core::Context&)>> deferred_;    ///< @brief 延迟命令（按记录顺序）
+    bool exclusive_ = false;                    ///< @brief 是否显式要求独占执行
+};
+} // namespace engine::system
@@ -0,0 +1,47 @@
+#pragma once
+#include "system.hpp"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace engine::system {
+/**
+ * @brief 按组件读写依赖图调度一组系统
+ *
+ * 系统按添加顺序绑定到 entt::flow：读写同一组件的系统之间连边（写-写、读-写都按添加顺序串行），
+ * 只读同一组件或互不相关的系统在 JobSystem 的工作线程上并行执行，独占系统是同步点。
+ * 所有系统结束后，在调用线程上按添加顺序执行各系统的延迟命令，
+ * 因此无论工作线程数量与执行先后如何，一帧的结果都相同。
+ */
+class SystemScheduler final {
+public:
+    SystemScheduler() = default;
+    ~SystemScheduler();
+
+    SystemScheduler(const SystemScheduler&) = delete;
+    SystemScheduler& operator=(const SystemScheduler&) = delete;
+    SystemScheduler(SystemScheduler&&) = delete;
+    SystemScheduler& operator=(SystemScheduler&&) = delete;
+
+    void add(std::unique_ptr<System> system);   ///< @brief 添加一个系统（下次执行前重建依赖图）
+
+    /**
+     * @brief 执行所有系统并合并延迟命令，返回时所有系统均已完成
+     * @param registry 场景的组件注册表
+     * @param delta 时间步长
+     * @param context 引擎上下文（使用其中的 JobSystem 与 Profiler）
+     */
+    void run(engine::object::ObjectRegistry& registry, sf::Time delta, engine::core::Context& context);
+
+    const std::vector<std::unique_ptr<System>>& get_systems() const { return systems_; }   ///< @brief 获取所有系统（添加顺序）
+    const std::vector<std::size_t>& get_dependencies(std::size_t index) const { return dependencies_[index]; }  ///< @brief 获取系统直接依赖的系统下标
+
+private:
+    void rebuild_graph();                                   ///< @brief 根据各系统声明的访问重建依赖图
+
+    std::vector<std::unique_ptr<System>> systems_;          ///< @brief 系统（添加顺序）
+    std::vector<std::vector<std::size_t>> dependencies_;    ///< @brief 每个系统必须等待的系统下标（均小于自身下标）
+    bool has_parallelism_ = false;                          ///< @brief 依赖图中是否存在可以并行的系统
+    bool dirty_ = false;                                    ///< @brief 是否需要重建依赖图
+};
+} // namespace engine::system
@@ -10,5 +10,6 @@ enum class Action {
     Attack,
     Pause,
     MouseLeft,
-    MouseRight
+    MouseRight,
+    FastForward
 };
@@ -0,0 +1,112 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::utils {
+/**
+ * @brief 场景级的内存池：从大块内存中切分小对象，析构时一次性释放所有块
+ *
+ * 小于等于 MAX_SMALL_SIZE 的分配按 16 字节分级，释放后进入对应等级的空闲链表供后续复用，
+ * 因此一局中不断生成/销毁的对象不会让内存池无限增长；更大的分配直接向系统申请并单独记录。
+ * 用于游戏对象、组件及其注册表的存储，使同一场景的对象集中在少数几个内存块中。
+ * @note 不是线程安全的，只能在场景所在的线程（更新线程）上使用。
+ */
+class Arena final {
+public:
+    /// @brief 内存使用统计（字节）
+    struct Stats {
+        std::size_t live_bytes = 0;         ///< @brief 当前正在使用的字节数
+        std::size_t high_water_bytes = 0;   ///< @brief live_bytes 的历史峰值
+        std::size_t reserved_bytes = 0;     ///< @brief 向系统申请的总字节数（块 + 大对象）
+        std::size_t block_count = 0;        ///< @brief 已申请的块数量
+        std::size_t allocation_count = 0;   ///< @brief 累计分配次数
+    };
+
+    static constexpr std::size_t SIZE_CLASS_GRANULARITY = 16;      ///< @brief 小对象分级粒度（同时也是小对象的对齐）
+    static constexpr std::size_t MAX_SMALL_SIZE = 1024;            ///< @brief 小对象的最大尺寸
+    static constexpr std::size_t DEFAULT_BLOCK_SIZE = 64 * 1024;   ///< @brief 默认块大小
+
+    explicit Arena(std::size_t block_size = DEFAULT_BLOCK_SIZE);
+    ~Arena();               ///< @brief 一次性释放所有块（此时所有对象必须已经析构）
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    Arena(Arena&&) = delete;
+    Arena& operator=(Arena&&) = delete;
+
+    void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));  ///< @brief 分配内存，失败时抛出 std::bad_alloc
+    void deallocate(void* ptr, std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));   ///< @brief 归还内存（大小与对齐必须与分配时一致）
+
+    const Stats& get_stats() const { return stats_; }      ///< @brief 获取内存使用统计
+
+private:
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    static constexpr std::size_t SIZE_CLASS_COUNT = MAX_SMALL_SIZE / SIZE_CLASS_GRANULARITY;
+
+    static bool is_small(std::size_t bytes, std::size_t alignment) { return bytes <= MAX_SMALL_SIZE && alignment <= SIZE_CLASS_GRANULARITY; }
+    static std::size_t size_class(std::size_t bytes) { return (bytes + SIZE_CLASS_GRANULARITY - 1) / SIZE_CLASS_GRANULARITY - (bytes > 0 ? 1 : 0); }
+    void* allocate_from_block(std::size_t bytes);          ///< @brief 从当前块切分（不够时申请新块）
+    void track_allocation(std::size_t bytes);
+
+    /// @brief 释放内存块用的删除器（块按 SIZE_CLASS_GRANULARITY 对齐申请）
+    struct BlockDeleter {
+        void operator()(std::byte* block) const;
+    };
+
+    std::size_t block_size_;                                            ///< @brief 每块大小
+    std::vector<std::unique_ptr<std::byte[], BlockDeleter>> blocks_;    ///< @brief 所有内存块
+    std::byte* cursor_ = nullptr;                                       ///< @brief 当前块中下一个可用位置
+    std::byte* block_end_ = nullptr;                                    ///< @brief 当前块的末尾
+    std::array<FreeNode*, SIZE_CLASS_COUNT> free_lists_{};              ///< @brief 各尺寸等级的空闲链表
+    std::unordered_map<void*, std::size_t> large_allocations_;          ///< @brief 大对象地址 -> 对齐（析构时统一释放剩余的）
+    Stats stats_;                                                       ///< @brief 内存使用统计
+};
+
+/**
+ * @brief 符合标准 Allocator 要求的 Arena 适配器，可用于 STL 容器和 entt::basic_registry
+ * @note 默认构造（未绑定内存池）时退化为普通的堆分配
+ */
+template <typename T>
+class ArenaAllocator {
+    template <typename> friend class ArenaAllocator;
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    ArenaAllocator() noexcept = default;
+    explicit ArenaAllocator(Arena& arena) noexcept : arena_obs_{&arena} {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena_obs_{other.arena_obs_} {}
+
+    T* allocate(std::size_t count) {
+        if (arena_obs_) {
+            return static_cast<T*>(arena_obs_->allocate(count * sizeof(T), alignof(T)));
+        }
+        return std::allocator<T>{}.allocate(count);
+    }
+
+    void deallocate(T* ptr, std::size_t count) noexcept {
+        if (arena_obs_) {
+            arena_obs_->deallocate(ptr, count * sizeof(T), alignof(T));
+        } else {
+            std::allocator<T>{}.deallocate(ptr, count);
+        }
+    }
+
+    Arena* get_arena() const noexcept { return arena_obs_; }   ///< @brief 获取绑定的内存池（可能为空）
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept { return arena_obs_ == other.arena_obs_; }
+
+private:
+    Arena* arena_obs_ = nullptr;    ///< @brief 绑定的内存池，为空时使用堆
+};
+} // namespace engine::utils
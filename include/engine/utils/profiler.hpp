@@ -0,0 +1,138 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <vector>
+
+namespace engine::utils {
+/**
+ * @brief 组件参与的循环阶段，用于按组件类型区分计时区域
+ */
+enum class ComponentPhase {
+    HandleInput,    ///< @brief 处理输入
+    Update,         ///< @brief 更新
+    Render          ///< @brief 渲染
+};
+
+/**
+ * @brief 每帧热点路径性能分析器
+ *
+ * 通过 ScopedZone (RAII) 记录各计时区域在一帧内的累计耗时，
+ * 每帧结束时折叠到滚动历史中，用于计算 min/avg/p99 并通过 ImGui 叠加层显示。
+ * 记录只做一次原子加法，可以在任意线程调用；未启用时计时区域只读取一个原子标志。
+ */
+class Profiler final {
+public:
+    using ZoneId = std::uint16_t;
+    static constexpr std::size_t MAX_ZONES = 256;               ///< @brief 计时区域数量上限
+    static constexpr std::size_t HISTORY_SIZE = 240;            ///< @brief 每个区域保留的历史帧数
+    static constexpr ZoneId INVALID_ZONE = static_cast<ZoneId>(MAX_ZONES);
+
+    /**
+     * @brief 单个计时区域的统计结果（单位：毫秒）
+     */
+    struct ZoneStats {
+        std::string name;           ///< @brief 区域名称
+        std::uint32_t calls = 0;    ///< @brief 最近一帧的调用次数
+        float last_ms = 0.f;        ///< @brief 最近一帧的累计耗时
+        float min_ms = 0.f;         ///< @brief 历史最小值
+        float avg_ms = 0.f;         ///< @brief 历史平均值
+        float p99_ms = 0.f;         ///< @brief 历史 99 分位
+    };
+
+    Profiler();
+    ~Profiler();
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+    Profiler(Profiler&&) = delete;
+    Profiler& operator=(Profiler&&) = delete;
+
+    /**
+     * @brief 注册（或查找）一个具名计时区域，线程安全。
+     * @note 注册表是全局的，调用点通常用静态局部变量缓存返回值（见 ENGINE_PROFILE_ZONE）。
+     * @return ZoneId 区域 id，超出上限时返回 INVALID_ZONE
+     */
+    static ZoneId register_zone(std::string_view name);
+
+    /**
+     * @brief 注册（或查找）某个组件类型在指定阶段的计时区域，名称形如 "SpriteComponent::render"
+     * @note 需要加锁并查找哈希表，只在分配组件类型 id 时调用；热点路径使用 engine::component::get_component_zone
+     */
+    static ZoneId register_component_zone(std::type_index type, ComponentPhase phase);
+
+    bool is_enabled() const { return enabled_.load(std::memory_order_relaxed); }   ///< @brief 是否正在采集
+    void set_enabled(bool enabled);                                                 ///< @brief 开启/关闭采集（关闭时清空历史）
+
+    /**
+     * @brief 记录一次区域耗时（累加到当前帧），线程安全
+     * @param id 区域 id
+     * @param nanoseconds 耗时（纳秒）
+     */
+    void record(ZoneId id, std::int64_t nanoseconds);
+
+    /**
+     * @brief 结束一帧：把当前帧的累计值写入滚动历史并清零（主线程每帧调用一次）
+     */
+    void end_frame();
+
+    std::vector<ZoneStats> collect_stats() const;      ///< @brief 计算所有有数据的区域的统计结果
+    void draw_overlay() const;                          ///< @brief 使用 ImGui 绘制统计窗口（需在 ImGui 帧内调用）
+
+private:
+    /// @brief 每个区域的滚动历史（只由主线程在 end_frame 中写入）
+    struct History {
+        std::array<float, HISTORY_SIZE> samples_ms{};   ///< @brief 有调用的帧的累计耗时
+        std::size_t next = 0;                           ///< @brief 下一个写入位置
+        std::size_t count = 0;                          ///< @brief 已写入的样本数
+        std::uint32_t last_calls = 0;                   ///< @brief 最近一帧的调用次数
+        float last_ms = 0.f;                            ///< @brief 最近一帧的耗时
+    };
+
+    std::atomic<bool> enabled_ = false;                                 ///< @brief 是否采集
+    std::array<std::atomic<std::int64_t>, MAX_ZONES> frame_ns_{};       ///< @brief 当前帧各区域的累计纳秒
+    std::array<std::atomic<std::uint32_t>, MAX_ZONES> frame_calls_{};   ///< @brief 当前帧各区域的调用次数
+    std::unique_ptr<std::array<History, MAX_ZONES>> history_;           ///< @brief 历史数据（体积较大，放在堆上）
+};
+
+/**
+ * @brief RAII 计时区域，构造时开始计时，析构时把耗时记录到 Profiler
+ */
+class ScopedZone final {
+public:
+    ScopedZone(Profiler& profiler, Profiler::ZoneId id)
+        : profiler_obs_{profiler.is_enabled() && id != Profiler::INVALID_ZONE ? &profiler : nullptr}
+        , id_{id} {
+        if (profiler_obs_) start_ = std::chrono::steady_clock::now();
+    }
+    ~ScopedZone() {
+        if (profiler_obs_) {
+            auto elapsed = std::chrono::steady_clock::now() - start_;
+            profiler_obs_->record(id_, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+    }
+
+    ScopedZone(const ScopedZone&) = delete;
+    ScopedZone& operator=(const ScopedZone&) = delete;
+    ScopedZone(ScopedZone&&) = delete;
+    ScopedZone& operator=(ScopedZone&&) = delete;
+
+private:
+    Profiler* profiler_obs_ = nullptr;                      ///< @brief 未启用时为空，析构不做任何事
+    Profiler::ZoneId id_;
+    std::chrono::steady_clock::time_point start_;
+};
+} // namespace engine::utils
+
+#define ENGINE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define ENGINE_PROFILE_CONCAT(a, b) ENGINE_PROFILE_CONCAT_IMPL(a, b)
+
+/// @brief 在当前作用域内创建一个具名计时区域，区域 id 只在第一次经过时注册
+#define ENGINE_PROFILE_ZONE(profiler, name)                                                                          \
+    static const auto ENGINE_PROFILE_CONCAT(profile_zone_id_, __LINE__) = engine::utils::Profiler::register_zone(name); \
+    engine::utils::ScopedZone ENGINE_PROFILE_CONCAT(profile_zone_, __LINE__){(profiler), ENGINE_PROFILE_CONCAT(profile_zone_id_, __LINE__)}
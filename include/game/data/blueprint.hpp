@@ -0,0 +1,118 @@
+#pragma once
+#include <entt/core/fwd.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace sf {
+    class Texture;
+} // namespace sf
+
+namespace engine::render {
+    class Animation;
+} // namespace engine::render
+
+namespace game::data {
+inline constexpr std::string_view ENEMY_INITIAL_ANIMATION = "walk";     ///< @brief 敌人生成后播放的动画
+inline constexpr std::string_view PLAYER_INITIAL_ANIMATION = "idle";    ///< @brief 玩家单位生成后播放的动画
+inline constexpr std::string_view ENEMY_TAG = "enemy";                  ///< @brief 敌人的标签
+inline constexpr std::string_view PLAYER_TAG = "player";                ///< @brief 玩家单位的标签
+inline constexpr std::string_view PROJECTILE_TAG = "projectile";        ///< @brief 投射物的标签
+inline constexpr std::string_view EFFECT_TAG = "effect";                ///< @brief 特效的标签
+
+/// @brief 动画中的帧事件（例如攻击动画第 6 帧触发 "hit"）
+struct AnimationEvent {
+    std::string name;       ///< @brief 事件名称（"hit"、"emit" 等）
+    int frame = 0;          ///< @brief 触发的帧序号
+};
+
+/// @brief 预先构建好的动画片段，所有实例共享同一份帧数据
+struct AnimationClip {
+    std::shared_ptr<const engine::render::Animation> animation;     ///< @brief 共享的动画
+    std::vector<AnimationEvent> events;                             ///< @brief 帧事件
+};
+
+/// @brief 精灵的显示数据（纹理已在加载时解析为指针）
+struct SpriteBlueprint {
+    const sf::Texture* texture = nullptr;   ///< @brief 精灵表纹理（由 ResourceManager 持有），不加载纹理时（无头模式）为空
+    sf::IntRect source_rect;                ///< @brief 初始显示区域（第一帧）
+    sf::Vector2f origin;                    ///< @brief 由偏移量换算的原点（精灵本地坐标）
+    sf::Vector2f scale{1.f, 1.f};           ///< @brief 显示尺寸与帧尺寸之比
+    bool face_right = true;                 ///< @brief 精灵表中角色是否朝右
+};
+
+/// @brief 音效 id 与已解析的音效文件路径
+struct SoundBlueprint {
+    std::string id;         ///< @brief 组件内的音效 id（"hit" 等）
+    std::string path;       ///< @brief 音效文件路径
+};
+
+/// @brief 单位的战斗属性
+struct UnitStats {
+    int hp = 1;                                 ///< @brief 生命值
+    int atk = 0;                                ///< @brief 攻击力
+    int def = 0;                                ///< @brief 防御力
+    float range = 0.f;                          ///< @brief 攻击范围（像素）
+    sf::Time atk_interval = sf::seconds(1.f);   ///< @brief 攻击间隔
+};
+
+/// @brief 敌人原型（来自 enemy_data.json）
+struct EnemyBlueprint {
+    entt::id_type id{};                         ///< @brief 键名 id（entt::hashed_string）
+    std::string key;                            ///< @brief 键名（例如 "slime"）
+    std::string name;                           ///< @brief 显示名称
+    UnitStats stats;                            ///< @brief 战斗属性
+    float speed = 0.f;                          ///< @brief 移动速度（像素/秒）
+    bool ranged = false;                        ///< @brief 是否远程
+    entt::id_type projectile_id{};              ///< @brief 投射物键名 id（没有时为 0）
+    SpriteBlueprint sprite;                     ///< @brief 显示数据
+    std::vector<AnimationClip> clips;           ///< @brief 动画片段
+    std::vector<SoundBlueprint> sounds;         ///< @brief 音效
+};
+
+/// @brief 玩家单位的类型
+enum class UnitType {
+    Melee,      ///< @brief 近战
+    Ranged      ///< @brief 远程
+};
+
+/// @brief 玩家单位原型（来自 player_data.json）
+struct PlayerBlueprint {
+    entt::id_type id{};                         ///< @brief 键名 id（entt::hashed_string）
+    std::string key;                            ///< @brief 键名（例如 "warrior"）
+    std::string name;                           ///< @brief 显示名称
+    std::string description;                    ///< @brief 描述
+    UnitStats stats;                            ///< @brief 战斗属性
+    UnitType type = UnitType::Melee;            ///< @brief 单位类型
+    bool healer = false;                        ///< @brief 是否治疗单位
+    int block = 0;                              ///< @brief 阻挡数
+    int cost = 0;                               ///< @brief 部署费用
+    std::string skill;                          ///< @brief 技能键名
+    entt::id_type projectile_id{};              ///< @brief 投射物键名 id（没有时为 0）
+    SpriteBlueprint sprite;                     ///< @brief 显示数据
+    std::vector<AnimationClip> clips;           ///< @brief 动画片段
+    std::vector<SoundBlueprint> sounds;         ///< @brief 音效
+};
+
+/// @brief 投射物原型（来自 projectile_data.json）
+struct ProjectileBlueprint {
+    entt::id_type id{};                         ///< @brief 键名 id（entt::hashed_string）
+    std::string key;                            ///< @brief 键名（例如 "arrow"）
+    SpriteBlueprint sprite;                     ///< @brief 显示数据
+    float arc_height = 0.f;                     ///< @brief 弹道弧高（像素）
+    sf::Time total_flight_time = sf::Time::Zero;    ///< @brief 飞行总时长
+    std::vector<SoundBlueprint> sounds;         ///< @brief 音效
+};
+
+/// @brief 特效原型（来自 effect_data.json），多帧特效播放一次后移除
+struct EffectBlueprint {
+    entt::id_type id{};                         ///< @brief 键名 id（entt::hashed_string）
+    std::string key;                            ///< @brief 键名（例如 "heal"）
+    SpriteBlueprint sprite;                     ///< @brief 显示数据
+    AnimationClip clip;                         ///< @brief 特效动画
+};
+} // namespace game::data
@@ -0,0 +1,102 @@
+#pragma once
+#include "blueprint.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace engine::object {
+    class GameObject;
+    class ObjectPool;
+} // namespace engine::object
+
+namespace engine::scene {
+    class Scene;
+} // namespace engine::scene
+
+namespace game::data {
+class BlueprintRegistry;
+
+/**
+ * @brief 按蓝图划分的对象池集合（敌人、投射物、特效）
+ *
+ * 每个蓝图对应一个 engine::object::ObjectPool，未命中时通过 BlueprintRegistry::spawn 创建对象。
+ * 取出的对象已经恢复到蓝图状态（组件由 Component::reset 恢复，名称与标签由 BlueprintRegistry::restore 恢复），
+ * 这里只负责重新设置位置并播放初始动画。
+ * @note 应作为场景派生类的成员：场景运行期间对象池一直存在，场景基类析构时直接销毁剩余对象而不归还，
+ *       而池中的闲置对象在基类（及其注册表）之前销毁。
+ */
+class BlueprintPools final {
+public:
+    static constexpr std::size_t DEFAULT_PROJECTILE_WARM_UP = 16;   ///< @brief 每种投射物的默认预热数量
+    static constexpr std::size_t DEFAULT_EFFECT_WARM_UP = 8;        ///< @brief 每种特效的默认预热数量
+    static constexpr std::string_view DEFAULT_LEVEL_CONFIG_PATH = "assets/data/level_config.json";  ///< @brief 默认的关卡配置文件
+
+    /// @brief 单个对象池的统计快照
+    struct PoolReport {
+        std::string name;               ///< @brief 对象池名称（蓝图键名）
+        std::uint64_t hits = 0;         ///< @brief 命中次数
+        std::uint64_t misses = 0;       ///< @brief 未命中次数
+        std::size_t created = 0;        ///< @brief 累计创建的对象数
+        std::size_t peak_in_use = 0;    ///< @brief 使用峰值
+        float hit_rate = 1.f;           ///< @brief 命中率
+    };
+
+    /**
+     * @brief 构造函数，为注册表中的每个敌人、投射物、特效蓝图创建对象池（此时不创建对象）
+     * @param scene 对象所属的场景
+     * @param blueprints 蓝图注册表（生命周期长于本对象）
+     */
+    BlueprintPools(engine::scene::Scene& scene, const BlueprintRegistry& blueprints);
+    ~BlueprintPools();
+
+    BlueprintPools(const BlueprintPools&) = delete;
+    BlueprintPools& operator=(const BlueprintPools&) = delete;
+    BlueprintPools(BlueprintPools&&) = delete;
+    BlueprintPools& operator=(BlueprintPools&&) = delete;
+
+    /**
+     * @brief 按关卡配置计划预热（此时不创建对象，由 warm_up_step 分帧创建）
+     *
+     * 每种敌人预热到该关卡单波中出现的最大数量，投射物与特效使用默认数量；
+     * 关卡条目中可选的 "pool_warm_up" 对象（键名 -> 数量）会覆盖上面的数量。替换之前尚未完成的计划。
+     * @param level_index 要加载的关卡下标
+     * @param path 关卡配置文件路径
+     * @return bool 配置读取成功时返回 true（失败时仍按默认数量预热投射物与特效）
+     */
+    bool plan_warm_up(std::size_t level_index, std::string_view path = DEFAULT_LEVEL_CONFIG_PATH);
+
+    /**
+     * @brief 执行一步预热计划
+     * @param max_objects 本次最多创建的对象数
+     * @return std::size_t 本次创建的对象数
+     */
+    std::size_t warm_up_step(std::size_t max_objects);
+
+    bool is_warming_up() const { return !warm_up_queue_.empty(); }             ///< @brief 预热计划是否还有未创建的对象
+
+    // --- 从对象池取出对象（尚未加入场景，需再调用 add_game_object 或 safe_add_game_object） ---
+    std::unique_ptr<engine::object::GameObject> spawn(const EnemyBlueprint& blueprint, sf::Vector2f position);
+    std::unique_ptr<engine::object::GameObject> spawn(const ProjectileBlueprint& blueprint, sf::Vector2f position);
+    std::unique_ptr<engine::object::GameObject> spawn(const EffectBlueprint& blueprint, sf::Vector2f position);
+
+    engine::object::ObjectPool* get_pool(entt::id_type blueprint_id) const;    ///< @brief 获取蓝图对应的对象池，不存在时返回 nullptr
+    std::vector<PoolReport> collect_stats() const;                              ///< @brief 收集所有对象池的统计（按名称排序）
+    void log_stats() const;                                                     ///< @brief 以 info 级别输出所有被使用过的对象池的统计
+
+private:
+    template <typename Blueprint>
+    void add_pool(const Blueprint& blueprint);
+    template <typename Blueprint>
+    std::unique_ptr<engine::object::GameObject> acquire(const Blueprint& blueprint, sf::Vector2f position);
+
+    engine::scene::Scene& scene_;                                                           ///< @brief 对象所属的场景
+    const BlueprintRegistry& blueprints_;                                                   ///< @brief 蓝图注册表
+    std::unordered_map<entt::id_type, std::unique_ptr<engine::object::ObjectPool>> pools_;  ///< @brief 蓝图 id -> 对象池
+    std::vector<std::pair<engine::object::ObjectPool*, std::size_t>> warm_up_queue_;        ///< @brief 预热计划：对象池与还需创建的对象数
+};
+} // namespace game::data
@@ -0,0 +1,103 @@
+#pragma once
+#include "blueprint.hpp"
+#include <nlohmann/json_fwd.hpp>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::resource {
+    class ResourceManager;
+} // namespace engine::resource
+
+namespace engine::object {
+    class GameObject;
+} // namespace engine::object
+
+namespace engine::scene {
+    class Scene;
+} // namespace engine::scene
+
+namespace game::data {
+/**
+ * @brief 游戏对象蓝图注册表
+ *
+ * 启动时一次性解析 enemy/player/projectile/effect 数据文件，生成只读的原型：
+ * 纹理预先解析为指针，动画帧预先构建为共享的 Animation。
+ * 生成对象时只是按原型添加组件，不再读取 JSON、构建动画或按路径查找纹理。
+ * 调用方可以缓存 find_* 返回的指针（加载之后保持不变），生成时连一次映射查找也不需要。
+ * @note 只应在启动时加载一次；重新加载会使之前返回的指针失效。
+ */
+class BlueprintRegistry final {
+public:
+    BlueprintRegistry();
+    ~BlueprintRegistry();
+
+    BlueprintRegistry(const BlueprintRegistry&) = delete;
+    BlueprintRegistry& operator=(const BlueprintRegistry&) = delete;
+    BlueprintRegistry(BlueprintRegistry&&) = delete;
+    BlueprintRegistry& operator=(BlueprintRegistry&&) = delete;
+
+    static constexpr std::string_view DEFAULT_DATA_DIR = "assets/data";     ///< @brief 默认的数据目录
+
+    /**
+     * @brief 从数据目录加载所有蓝图
+     * @param resource_manager 用于加载（并持有）精灵表纹理
+     * @param data_dir 数据文件所在目录
+     * @param load_textures 是否加载精灵表纹理。无头模式没有渲染目标（也可能没有显示器可以创建 GL 上下文），
+     *                      应传 false：只解析显示区域，纹理留空，生成的精灵使用空纹理
+     * @return bool 所有文件都成功解析时返回 true（单个条目出错只会跳过该条目）
+     */
+    bool load(engine::resource::ResourceManager& resource_manager, std::string_view data_dir = DEFAULT_DATA_DIR, bool load_textures = true);
+
+    // --- 查找（找不到时返回 nullptr） ---
+    const EnemyBlueprint* find_enemy(entt::id_type id) const;
+    const EnemyBlueprint* find_enemy(std::string_view key) const;
+    const PlayerBlueprint* find_player(entt::id_type id) const;
+    const PlayerBlueprint* find_player(std::string_view key) const;
+    const ProjectileBlueprint* find_projectile(entt::id_type id) const;
+    const ProjectileBlueprint* find_projectile(std::string_view key) const;
+    const EffectBlueprint* find_effect(entt::id_type id) const;
+    const EffectBlueprint* find_effect(std::string_view key) const;
+
+    const std::vector<EnemyBlueprint>& get_enemies() const { return enemies_; }             ///< @brief 获取所有敌人蓝图
+    const std::vector<PlayerBlueprint>& get_players() const { return players_; }            ///< @brief 获取所有玩家单位蓝图
+    const std::vector<ProjectileBlueprint>& get_projectiles() const { return projectiles_; }///< @brief 获取所有投射物蓝图
+    const std::vector<EffectBlueprint>& get_effects() const { return effects_; }            ///< @brief 获取所有特效蓝图
+
+    // --- 按原型生成对象（尚未加入场景，需再调用 add_game_object 或 safe_add_game_object） ---
+    /// @brief 生成敌人：变换、精灵、动画（播放 ENEMY_INITIAL_ANIMATION）、生命值、音效，标签为 "enemy"，加入空间网格
+    static std::unique_ptr<engine::object::GameObject> spawn(engine::scene::Scene& scene, const EnemyBlueprint& blueprint, sf::Vector2f position);
+    /// @brief 生成玩家单位：变换、精灵、动画（播放 PLAYER_INITIAL_ANIMATION）、生命值、音效，标签为 "player"，加入空间网格
+    static std::unique_ptr<engine::object::GameObject> spawn(engine::scene::Scene& scene, const PlayerBlueprint& blueprint, sf::Vector2f position);
+    /// @brief 生成投射物：变换、精灵、音效，标签为 "projectile"
+    static std::unique_ptr<engine::object::GameObject> spawn(engine::scene::Scene& scene, const ProjectileBlueprint& blueprint, sf::Vector2f position);
+    /// @brief 生成特效：变换、精灵、动画（多帧特效播放一次后自动移除），标签为 "effect"
+    static std::unique_ptr<engine::object::GameObject> spawn(engine::scene::Scene& scene, const EffectBlueprint& blueprint, sf::Vector2f position);
+
+    // --- 恢复对象池复用的对象：组件由 Component::reset 恢复到构造时（即蓝图）的状态，这里恢复名称与标签 ---
+    static void restore(engine::object::GameObject& object, const EnemyBlueprint& blueprint);
+    static void restore(engine::object::GameObject& object, const PlayerBlueprint& blueprint);
+    static void restore(engine::object::GameObject& object, const ProjectileBlueprint& blueprint);
+    static void restore(engine::object::GameObject& object, const EffectBlueprint& blueprint);
+
+private:
+    /// @brief 加载上下文（解析期间使用的纹理缓存与音效映射）
+    struct LoadContext;
+
+    bool load_enemies(const nlohmann::json& json, LoadContext& load_context);
+    bool load_players(const nlohmann::json& json, LoadContext& load_context);
+    bool load_projectiles(const nlohmann::json& json, LoadContext& load_context);
+    bool load_effects(const nlohmann::json& json, LoadContext& load_context);
+
+    std::vector<EnemyBlueprint> enemies_;               ///< @brief 敌人蓝图
+    std::vector<PlayerBlueprint> players_;              ///< @brief 玩家单位蓝图
+    std::vector<ProjectileBlueprint> projectiles_;      ///< @brief 投射物蓝图
+    std::vector<EffectBlueprint> effects_;              ///< @brief 特效蓝图
+    std::unordered_map<entt::id_type, std::size_t> enemy_index_;        ///< @brief 键名 id -> enemies_ 下标
+    std::unordered_map<entt::id_type, std::size_t> player_index_;       ///< @brief 键名 id -> players_ 下标
+    std::unordered_map<entt::id_type, std::size_t> projectile_index_;   ///< @brief 键名 id -> projectiles_ 下标
+    std::unordered_map<entt::id_type, std::size_t> effect_index_;       ///< @brief 键名 id -> effects_ 下标
+};
+} // namespace game::data
@@ -1,5 +1,12 @@
 #pragma once
 #include "engine/scene/scene.hpp"
+#include <cstddef>
+#include <memory>
+
+namespace game::data {
+    class BlueprintRegistry;
+    class BlueprintPools;
+} // namespace game::data
 
 namespace game::scene {
 /**
@@ -7,11 +14,25 @@ namespace game::scene {
  */
 class GameScene final : public engine::scene::Scene {
 public:
-    GameScene(engine::core::Context& context);
+    static constexpr std::size_t WARM_UP_OBJECTS_PER_UPDATE = 8;   ///< @brief 每次更新最多预热创建的对象数
+
+    /**
+     * @brief 构造函数
+     * @param context 场景上下文
+     * @param blueprints 启动时加载的对象蓝图
+     * @param level_index 本场景加载的关卡下标（决定对象池的预热数量）
+     */
+    GameScene(engine::core::Context& context, const game::data::BlueprintRegistry& blueprints, std::size_t level_index = 0);
     
     ~GameScene();
 
+    void update(sf::Time delta) override;       ///< @brief 分帧预热对象池，然后更新场景
+
 private:
+    const game::data::BlueprintRegistry& blueprints_;   ///< @brief 启动时加载的对象蓝图（生命周期长于所有场景）
+    std::unique_ptr<game::data::BlueprintPools> pools_; ///< @brief 敌人、投射物、特效的对象池（按关卡配置分帧预热）
+    std::size_t level_index_ = 0;                       ///< @brief 本场景加载的关卡下标
+
     // --- 测试回调事件 ---
     int scene_index_ = 0;
     void on_replace();
@@ -2,11 +2,13 @@
 #include "engine/component/sprite_component.hpp"
 #include "engine/object/game_object.hpp"
 #include "engine/render/animation.hpp"
+#include <entt/core/hashed_string.hpp>
 #include <spdlog/spdlog.h>
 
 namespace engine::component{
 AnimationComponent::AnimationComponent(engine::object::GameObject* owner)
     : Component{owner} {
+    set_tick_phases({});    // 由 AnimationSystem 批量推进
     sprite_component_obs_ = owner_->get_component<SpriteComponent>();
     if (!sprite_component_obs_) {
         spdlog::error("GameObject '{}' 的 AnimationComponent 需要 SpriteComponent，但未找到。", owner_->get_name());
@@ -17,14 +19,22 @@ AnimationComponent::AnimationComponent(engine::object::GameObject* owner)
 AnimationComponent::~AnimationComponent() = default;
 
 void AnimationComponent::add_animation(std::unique_ptr<engine::render::Animation> animation) {
+    add_animation(std::shared_ptr<const engine::render::Animation>(std::move(animation)));
+}
+
+void AnimationComponent::add_animation(std::shared_ptr<const engine::render::Animation> animation) {
     if (!animation) return;
     std::string_view name = animation->get_name();    // 获取名称
-    animations_[std::string(name)] = std::move(animation);
+    const auto id = entt::hashed_string::value(name.data(), name.size());
+    if (auto it = animations_.find(id); it != animations_.end() && it->second->get_name() != name) {
+        spdlog::warn("GameObject '{}' 的动画 '{}' 与 '{}' 名称哈希冲突，旧动画被覆盖", owner_->get_name(), name, it->second->get_name());
+    }
+    animations_[id] = std::move(animation);
     spdlog::debug("已将动画 '{}' 添加到 GameObject '{}'", name, owner_->get_name());
 }
 
 void AnimationComponent::play_animation(std::string_view name) {
-    auto it = animations_.find(std::string(name));
+    auto it = animations_.find(entt::hashed_string::value(name.data(), name.size()));
     if (it == animations_.end() || !it->second) {
         spdlog::warn("未找到 GameObject '{}' 的动画 '{}'", name, owner_->get_name());
         return;
@@ -64,10 +74,16 @@ bool AnimationComponent::is_animation_finished() const {
 }
 
 void AnimationComponent::update(sf::Time delta, engine::core::Context&) {
+    if (advance(delta)) {
+        owner_->set_need_remove(true);
+    }
+}
+
+bool AnimationComponent::advance(sf::Time delta) {
     // 如果没有正在播放的动画，或者没有当前动画，或者没有精灵组件，或者当前动画没有帧，则直接返回
     if (!is_playing_ || !current_animation_obs_ || !sprite_component_obs_ || current_animation_obs_->is_empty()) {
         spdlog::trace("AnimationComponent 更新时没有正在播放的动画或精灵组件为空。");
-        return;
+        return false;
     }
 
     // 推进计时器
@@ -84,9 +100,14 @@ void AnimationComponent::update(sf::Time delta, engine::core::Context&) {
     if (!current_animation_obs_->is_looping() && animation_timer_ >= current_animation_obs_->get_total_duration()) {
         is_playing_ = false;
         animation_timer_ = current_animation_obs_->get_total_duration(); // 将时间限制在结束点
-        if (is_one_shot_removal_) {     // 如果 is_one_shot_removal_ 为 true，则删除整个 GameObject
-            owner_->set_need_remove(true);
-        }
+        return is_one_shot_removal_;    // 如果 is_one_shot_removal_ 为 true，则需要删除整个 GameObject
     }
+    return false;
+}
+
+void AnimationComponent::reset() {
+    current_animation_obs_ = nullptr;
+    animation_timer_ = sf::Time::Zero;
+    is_playing_ = false;
 }
-} // namespace engine::component
\ No newline at end of file
+} // namespace engine::component
@@ -11,6 +11,7 @@ AudioComponent::AudioComponent(engine::object::GameObject* owner, engine::audio:
     : Component{owner}
     , audio_player_obs_{audio_player}
     , camera_obs_{camera} {
+    set_tick_phases({});    // 只响应播放请求，不需要每帧调用
     if (!audio_player_obs_ || !camera_obs_) {
         spdlog::error("AudioComponent 初始化失败: 音频播放器或相机为空");
     }
@@ -1,4 +1,5 @@
 #include "engine/component/component.hpp"
+#include "engine/object/game_object.hpp"
 
 namespace engine::component {
 Component::Component(engine::object::GameObject* owner)
@@ -12,4 +13,25 @@ void Component::set_owner(engine::object::GameObject* owner) {
 engine::object::GameObject* Component::get_owner() const {
     return this->owner_;
 }
+
+void Component::set_ticking(engine::utils::ComponentPhase phase, bool enabled) {
+    const auto mask = enabled ? (tick_mask_ | phase_bit(phase)) : (tick_mask_ & ~phase_bit(phase));
+    if (mask == tick_mask_) return;
+    tick_mask_ = static_cast<std::uint8_t>(mask);
+    notify_tick_changed();
+}
+
+void Component::set_tick_phases(std::initializer_list<engine::utils::ComponentPhase> phases) {
+    std::uint8_t mask = 0;
+    for (auto phase : phases) {
+        mask |= phase_bit(phase);
+    }
+    if (mask == tick_mask_) return;
+    tick_mask_ = mask;
+    notify_tick_changed();
+}
+
+void Component::notify_tick_changed() {
+    if (owner_) owner_->on_component_tick_changed(this);
+}
 } // namespace engine::component
\ No newline at end of file
@@ -0,0 +1,38 @@
+#include "engine/component/component_type_id.hpp"
+#include <spdlog/spdlog.h>
+#include <array>
+#include <atomic>
+
+namespace engine::component {
+namespace {
+std::atomic<std::size_t> next_id = 0;
+std::array<const std::type_info*, MAX_COMPONENT_TYPES> type_infos{};   // 只在分配 id 时写入，之后只读
+std::array<std::array<engine::utils::Profiler::ZoneId, 3>, MAX_COMPONENT_TYPES> zone_ids{};    // 按 [类型 id][ComponentPhase] 索引，同上
+} // namespace
+
+namespace detail {
+ComponentTypeId register_component_type(const std::type_info& type) {
+    const auto id = next_id.fetch_add(1, std::memory_order_relaxed);
+    if (id >= MAX_COMPONENT_TYPES) {
+        spdlog::error("组件类型数量超过上限 {}，无法为 '{}' 分配 id，请增大 MAX_COMPONENT_TYPES", MAX_COMPONENT_TYPES, type.name());
+        return INVALID_COMPONENT_TYPE;
+    }
+    type_infos[id] = &type;
+    // 计时区域在这里一次性注册（需要加锁），热点路径中只按下标读取
+    for (std::size_t phase = 0; phase < zone_ids[id].size(); ++phase) {
+        zone_ids[id][phase] = engine::utils::Profiler::register_component_zone(std::type_index(type), static_cast<engine::utils::ComponentPhase>(phase));
+    }
+    return static_cast<ComponentTypeId>(id);
+}
+} // namespace detail
+
+std::type_index get_component_type_index(ComponentTypeId id) {
+    // 调用方的 id 来自 component_type_id 的静态局部变量初始化，保证能看到这里的写入
+    return std::type_index(*type_infos[id]);
+}
+
+engine::utils::Profiler::ZoneId get_component_zone(ComponentTypeId id, engine::utils::ComponentPhase phase) {
+    if (id >= MAX_COMPONENT_TYPES) return engine::utils::Profiler::INVALID_ZONE;
+    return zone_ids[id][static_cast<std::size_t>(phase)];
+}
+} // namespace engine::component
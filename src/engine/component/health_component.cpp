@@ -7,7 +7,10 @@ HealthComponent::HealthComponent(engine::object::GameObject* owner, int max_heal
     : Component{owner}
     , max_health_{std::max(1, max_health)}
     , current_health_{max_health_}
-    , invincibility_duration_{invincibility_duration} {
+    , invincibility_duration_{invincibility_duration}
+    , initial_max_health_{max_health_}
+    , initial_invincibility_duration_{invincibility_duration} {
+    set_tick_phases({});    // 由 HealthSystem 批量推进无敌计时器
 }
 
 bool HealthComponent::take_damage(int damage_amount) {
@@ -68,7 +71,10 @@ void HealthComponent::set_invincible(sf::Time duration) {
 }
 
 void HealthComponent::update(sf::Time delta, engine::core::Context&) {
-    // 更新无敌状态计时器
+    tick_invincibility(delta);
+}
+
+void HealthComponent::tick_invincibility(sf::Time delta) {
     if (is_invincible_) {
         invincibility_timer_ -= delta;
         if (invincibility_timer_ <= sf::Time::Zero) {
@@ -77,4 +83,12 @@ void HealthComponent::update(sf::Time delta, engine::core::Context&) {
         }
     }
 }
-} // namespace engine::component
\ No newline at end of file
+
+void HealthComponent::reset() {
+    max_health_ = initial_max_health_;
+    invincibility_duration_ = initial_invincibility_duration_;
+    current_health_ = max_health_;
+    is_invincible_ = false;
+    invincibility_timer_ = sf::Time::Zero;
+}
+} // namespace engine::component
@@ -14,6 +14,7 @@ ParallaxComponent::ParallaxComponent(engine::object::GameObject* owner
     , scroll_factor_{std::move(scroll_factor)}
     , repeat_{std::move(repeat)} {
     ///< @attention transform_obs_ 在渲染函数调用时初始化，并确保了只初始化一次
+    set_tick_phases({engine::utils::ComponentPhase::Render});
 }
 
 ParallaxComponent::~ParallaxComponent() = default;
@@ -1,49 +1,45 @@
 #include "engine/component/sprite_component.hpp"
 #include "engine/component/transform_component.hpp"
 #include "engine/object/game_object.hpp"
-#include "engine/render/render.hpp"
-#include "engine/render/camera.hpp"
 #include "engine/core/context.hpp"
 #include <spdlog/spdlog.h>
 
 namespace engine::component {
 SpriteComponent::SpriteComponent(engine::object::GameObject* owner, const sf::Texture& texture)
     : Component{owner}
-    , sprite_{texture} {
-    ///< @attention transform_obs_ 在渲染函数调用时初始化，并确保了只初始化一次
+    , sprite_{texture}
+    , initial_texture_rect_{sprite_.getTextureRect()}
+    , initial_color_{sprite_.getColor()} {
+    set_tick_phases({});    // 由场景按相机视口剔除后加入渲染队列
 }
 
 SpriteComponent::SpriteComponent(engine::object::GameObject* owner, sf::Sprite&& sprite) 
     : Component{owner}
-    , sprite_{sprite} {
+    , sprite_{sprite}
+    , initial_texture_rect_{sprite_.getTextureRect()}
+    , initial_color_{sprite_.getColor()} {
+    set_tick_phases({});    // 由场景按相机视口剔除后加入渲染队列
 }
 
-void SpriteComponent::render(engine::core::Context& context) {
-    if (!transform_obs_) {
-        transform_obs_ = owner_->get_component<TransformComponent>();
-        if (!transform_obs_) {
-            spdlog::warn(
-                "GameObject '{}' 上的 SpriteComponent 需要一个 TransformComponent，但未找到。",
-                owner_->get_name()
-            );
-        }
-    }
+void SpriteComponent::reset() {
+    sprite_.setTextureRect(initial_texture_rect_);
+    sprite_.setColor(initial_color_);
+    is_hidden_ = false;
+}
+
+void SpriteComponent::sync_transform(const TransformComponent& transform, float alpha) {
+    sprite_.setOrigin(transform.get_origin());
+    // 在上一次与当前固定步长的位置之间插值，使渲染频率高于模拟频率时也能平滑移动
+    sprite_.setPosition(transform.get_interpolated_position(alpha));
+    sprite_.setScale(transform.get_scale());
+    sprite_.setRotation(transform.get_rotation());
+}
+
+void SpriteComponent::enqueue(engine::render::RenderQueue& queue) {
     if (is_hidden_) {
         return;
     }
-
-    // 获取变换信息（考虑偏移量）
-    const sf::Vector2f& origin = transform_obs_->get_origin();
-    const sf::Vector2f& position = transform_obs_->get_position();
-    const sf::Vector2f& scale = transform_obs_->get_scale();
-    sf::Angle rotation = transform_obs_->get_rotation();
-
-    sprite_.setOrigin(origin);
-    sprite_.setPosition(position);
-    sprite_.setScale(scale);
-    sprite_.setRotation(rotation);
-    
-    // 执行绘制
-    context.get_renderer().draw_sprite(context.get_camera(), sprite_);
+    // 变换已由 SpriteSyncSystem 在渲染前同步，精灵位置即对象位置（通常在脚下）
+    queue.push(render_layer_, sprite_.getPosition().y, sprite_);
 }
 } // namespace engine::core
\ No newline at end of file
@@ -1,46 +1,86 @@
 #include "engine/component/tilelayer_component.hpp"
 #include "engine/core/context.hpp"
+#include "engine/render/camera.hpp"
 #include "engine/render/render.hpp"
+#include "engine/object/game_object.hpp"
+#include "engine/scene/scene.hpp"
+#include <SFML/Graphics/Vertex.hpp>
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cmath>
+#include <utility>
 
 namespace engine::component {
+namespace {
+constexpr std::uint64_t CHUNK_EVICT_CHECK_INTERVAL = 60;    // 每隔多少帧检查一次需要释放的块
+} // namespace
+
 TileLayerComponent::TileLayerComponent(engine::object::GameObject* owner
                                      , sf::Vector2i tile_size
                                      , sf::Vector2i map_size
-                                     , std::vector<TileInfo>&& tiles)
+                                     , std::vector<std::shared_ptr<const Tileset>> tilesets
+                                     , std::vector<TileId>&& tiles)
     : Component{owner}
     , tile_size_{std::move(tile_size)}
     , map_size_{std::move(map_size)}
+    , tilesets_{std::move(tilesets)}
     , tiles_{std::move(tiles)} {
+    set_tick_phases({engine::utils::ComponentPhase::Render});
     if (tiles_.size() != static_cast<size_t>(map_size_.x * map_size_.y)) {
         spdlog::error("TileLayerComponent: 地图尺寸与提供的瓦片向量大小不匹配。瓦片数据将被清除。");
         tiles_.clear();
         map_size_ = {0, 0};
     }
-    
+
+    // 由图块集表生成类型字节数组，同时统计图块伸出瓦片的最大尺寸
+    types_.resize(tiles_.size(), TileType::Empty);
+    for (size_t i = 0; i < tiles_.size(); ++i) {
+        const TileDefinition* definition = get_tile_definition(tiles_[i]);
+        if (!definition) {
+            if (tiles_[i] != EMPTY_TILE) {
+                spdlog::warn("TileLayerComponent: 无效的瓦片 id {:#x}，按空白瓦片处理", tiles_[i]);
+                tiles_[i] = EMPTY_TILE;
+            }
+            continue;
+        }
+        types_[i] = definition->type;
+        const sf::Vector2f overhang = get_tile_overhang(tiles_[i]);
+        max_overhang_ = {std::max(max_overhang_.x, overhang.x), std::max(max_overhang_.y, overhang.y)};
+    }
+
     spdlog::trace("TileLayerComponent 构造完成");
 }
 
 TileLayerComponent::~TileLayerComponent() {
-
+    // 场景可能在模拟线程中销毁，而主线程仍在提交引用块纹理的快照
+    for (auto& chunk : chunks_) release_chunk(chunk);
 }
 
-const TileInfo* TileLayerComponent::get_tile_info_at(sf::Vector2i pos) const {
+TileId TileLayerComponent::get_tile_at(sf::Vector2i pos) const {
     if (pos.x < 0 || pos.x >= map_size_.x || pos.y < 0 || pos.y >= map_size_.y) {
         spdlog::warn("TileLayerComponent: 瓦片坐标越界: ({}, {})", pos.x, pos.y);
-        return nullptr;
+        return EMPTY_TILE;
     }
-    size_t index = static_cast<size_t>(pos.y * map_size_.x + pos.x);
-    if (index < tiles_.size()) {
-        return &tiles_[index];
+    return tiles_[static_cast<size_t>(pos.y) * map_size_.x + pos.x];
+}
+
+const TileDefinition* TileLayerComponent::get_tile_definition(TileId id) const {
+    if (id == EMPTY_TILE) return nullptr;
+    const std::size_t tileset_index = id >> 24;
+    const std::size_t local_id = id & 0x00FFFFFFu;
+    if (tileset_index >= tilesets_.size() || !tilesets_[tileset_index] || !tilesets_[tileset_index]->texture
+        || local_id >= tilesets_[tileset_index]->tiles.size()) {
+        return nullptr;
     }
-    spdlog::warn("TileLayerComponent: 瓦片索引越界: {}", index);
-    return nullptr;
+    return &tilesets_[tileset_index]->tiles[local_id];
 }
 
 TileType TileLayerComponent::get_tile_type_at(sf::Vector2i pos) const {
-    const TileInfo* info = get_tile_info_at(pos);
-    return info ? info->type : TileType::Empty;
+    if (pos.x < 0 || pos.x >= map_size_.x || pos.y < 0 || pos.y >= map_size_.y) {
+        spdlog::warn("TileLayerComponent: 瓦片坐标越界: ({}, {})", pos.x, pos.y);
+        return TileType::Empty;
+    }
+    return types_[static_cast<size_t>(pos.y) * map_size_.x + pos.x];
 }
 
 TileType TileLayerComponent::get_tile_type_at_world_pos(const sf::Vector2f& world_pos) const {
@@ -52,133 +92,254 @@ TileType TileLayerComponent::get_tile_type_at_world_pos(const sf::Vector2f& worl
     return get_tile_type_at(sf::Vector2i{tile_x, tile_y});
 }
 
-void TileLayerComponent::rebuild_cache() const {
-    if (tile_size_.x <= 0 || tile_size_.y <= 0 || map_size_.x <= 0 || map_size_.y <= 0) {
-        spdlog::warn("TileLayerComponent: 无效的瓦片尺寸或地图尺寸");
-        return;
+sf::Vector2i TileLayerComponent::get_chunk_count() const {
+    return {(map_size_.x + CHUNK_SIZE - 1) / CHUNK_SIZE, (map_size_.y + CHUNK_SIZE - 1) / CHUNK_SIZE};
+}
+
+int TileLayerComponent::get_row_pitch() const {
+    return tile_size_.y + static_cast<int>(std::ceil(max_overhang_.y));
+}
+
+void TileLayerComponent::set_render_layer(engine::render::RenderLayer layer) {
+    if (render_layer_ == layer) return;
+    render_layer_ = layer;
+    for (auto& chunk : chunks_) chunk.dirty = true;
+}
+
+sf::Vector2f TileLayerComponent::get_tile_overhang(TileId tile) const {
+    const TileDefinition* definition = get_tile_definition(tile);
+    if (!definition) return {0.f, 0.f};
+    const sf::Vector2i size = definition->texture_rect.size;
+    return {static_cast<float>(std::max(0, size.x - tile_size_.x)), static_cast<float>(std::max(0, size.y - tile_size_.y))};
+}
+
+bool TileLayerComponent::set_tile_at(sf::Vector2i pos, TileId tile) {
+    if (pos.x < 0 || pos.x >= map_size_.x || pos.y < 0 || pos.y >= map_size_.y) {
+        spdlog::warn("TileLayerComponent: 瓦片坐标越界: ({}, {})", pos.x, pos.y);
+        return false;
+    }
+    const TileDefinition* definition = get_tile_definition(tile);
+    if (!definition && tile != EMPTY_TILE) {
+        spdlog::warn("TileLayerComponent: 无效的瓦片 id {:#x}", tile);
+        return false;
     }
+    const sf::Vector2f overhang = get_tile_overhang(tile);
+    const size_t index = static_cast<size_t>(pos.y) * map_size_.x + pos.x;
+    tiles_[index] = tile;
+    types_[index] = definition ? definition->type : TileType::Empty;
+    if (overhang.x > max_overhang_.x || overhang.y > max_overhang_.y) {
+        // 块纹理按最大伸出量留边，伸出量变大时所有块都要按新尺寸重建
+        max_overhang_ = {std::max(max_overhang_.x, overhang.x), std::max(max_overhang_.y, overhang.y)};
+        for (auto& chunk : chunks_) chunk.dirty = true;
+    } else {
+        mark_chunk_dirty({pos.x / CHUNK_SIZE, pos.y / CHUNK_SIZE});
+    }
+    return true;
+}
 
-    // 计算整个层的像素尺寸
-    unsigned int total_width = static_cast<unsigned int>(map_size_.x * tile_size_.x);
-    unsigned int total_height = static_cast<unsigned int>(map_size_.y * tile_size_.y);
-    
-    // 计算最大精灵高度以确定是否需要额外空间
-    unsigned int max_sprite_height = static_cast<unsigned int>(tile_size_.y);
-    for (const auto& tile_info : tiles_) {
-        if (tile_info.type != TileType::Empty) {
-            unsigned int sprite_height = static_cast<unsigned int>(tile_info.sprite.getGlobalBounds().size.y);
-            if (sprite_height > max_sprite_height) {
-                max_sprite_height = sprite_height;
-            }
+void TileLayerComponent::mark_chunk_dirty(sf::Vector2i chunk_pos) {
+    const sf::Vector2i chunk_count = get_chunk_count();
+    if (chunk_pos.x < 0 || chunk_pos.x >= chunk_count.x || chunk_pos.y < 0 || chunk_pos.y >= chunk_count.y) return;
+    if (chunks_.empty()) return;        // 还没有渲染过，首次渲染时会构建
+    chunks_[static_cast<size_t>(chunk_pos.y) * chunk_count.x + chunk_pos.x].dirty = true;
+}
+
+bool TileLayerComponent::rebuild_chunk(Chunk& chunk, sf::Vector2i chunk_pos) {
+    const sf::Vector2i first = chunk_pos * CHUNK_SIZE;
+    const sf::Vector2i last = {std::min(first.x + CHUNK_SIZE, map_size_.x), std::min(first.y + CHUNK_SIZE, map_size_.y)};
+    chunk.dirty = false;
+    chunk.fallback_sprites.clear();
+
+    bool has_tiles = false;
+    for (int y = first.y; y < last.y && !has_tiles; ++y) {
+        for (int x = first.x; x < last.x && !has_tiles; ++x) {
+            has_tiles = tiles_[static_cast<size_t>(y) * map_size_.x + x] != EMPTY_TILE;
         }
     }
-    
-    // 如果有精灵高度超过瓦片高度，调整总高度
-    if (max_sprite_height > static_cast<unsigned int>(tile_size_.y)) {
-        total_height = static_cast<unsigned int>(map_size_.y * tile_size_.y) + 
-                      (max_sprite_height - static_cast<unsigned int>(tile_size_.y));
-        spdlog::debug("TileLayerComponent: 检测到高精灵，调整纹理高度为 {}", total_height);
+    if (!has_tiles) {
+        release_chunk(chunk);       // 空块不需要纹理，也不绘制
+        return true;
     }
 
-    // 创建或重新创建渲染纹理
-    if (!render_texture_.resize({total_width, total_height})) {
-        spdlog::error("TileLayerComponent: 无法创建 RenderTexture，大小 {}x{}", total_width, total_height);
-        return;
+    // 块纹理覆盖块内的瓦片，再向右、向上留出瓦片精灵伸出的部分；
+    // 排序层每个瓦片行单独占一条带（各自留出向上伸出的部分），每行可以有自己的深度
+    const bool row_sorted = is_row_sorted();
+    const int top_margin = static_cast<int>(std::ceil(max_overhang_.y));
+    const int row_pitch = row_sorted ? get_row_pitch() : tile_size_.y;
+    const int rows = last.y - first.y;
+    const sf::Vector2u size = {static_cast<unsigned int>((last.x - first.x) * tile_size_.x + static_cast<int>(std::ceil(max_overhang_.x)))
+                             , static_cast<unsigned int>(row_sorted ? rows * row_pitch : rows * tile_size_.y + top_margin)};
+    // 当前纹理可能被上一帧的快照引用（流水线模式下主线程正在提交），绘制到后备纹理，完成后交换。
+    // 后备纹理最晚在上一次重建之前的帧中被引用，那一帧的快照在本帧录制之前已经提交完毕
+    if (!chunk.back_texture) chunk.back_texture = std::make_unique<sf::RenderTexture>();
+    if (chunk.back_texture->getSize() != size && !chunk.back_texture->resize(size)) {
+        spdlog::error("TileLayerComponent: 无法创建块 ({}, {}) 的 RenderTexture，大小 {}x{}", chunk_pos.x, chunk_pos.y, size.x, size.y);
+        release_chunk(chunk);
+        chunk.dirty = true;
+        return false;
     }
+    if (!chunk.texture) ++resident_chunks_;
+    std::swap(chunk.texture, chunk.back_texture);
 
-    // 清除为透明
-    render_texture_.clear(sf::Color::Transparent);
-
-    // 设置视图，确保坐标从(0,0)开始
-    sf::View view = render_texture_.getDefaultView();
-    // 使用 SFML 3 正确的 API - 通过 setCenter 和 setSize 设置视图
-    view.setCenter({total_width / 2.f, total_height / 2.f});
-    view.setSize({static_cast<float>(total_width), static_cast<float>(total_height)});
-    render_texture_.setView(view);
-
-    // 绘制所有瓦片
-    for (int y = 0; y < map_size_.y; ++y) {
-        for (int x = 0; x < map_size_.x; ++x) {
-            size_t index = static_cast<size_t>(y) * map_size_.x + x;
-            if (index >= tiles_.size() || tiles_[index].type == TileType::Empty) {
-                continue;
+    chunk.texture->clear(sf::Color::Transparent);
+    chunk.texture->setView(sf::View(sf::FloatRect({0.f, 0.f}, sf::Vector2f(size))));
+    chunk.sprites.clear();
+    // 由 id 数组直接生成顶点，同一图块集的连续瓦片一次绘制（按行主序，保持瓦片间的遮挡顺序）
+    std::vector<sf::Vertex> vertices;
+    vertices.reserve(static_cast<size_t>(CHUNK_SIZE * CHUNK_SIZE) * 6);
+    const sf::Texture* batch_texture = nullptr;
+    auto flush = [&]() {
+        if (!vertices.empty()) {
+            chunk.texture->draw(vertices.data(), vertices.size(), sf::PrimitiveType::Triangles, sf::RenderStates(batch_texture));
+            vertices.clear();
+        }
+    };
+    for (int y = first.y; y < last.y; ++y) {
+        bool row_has_tiles = false;
+        for (int x = first.x; x < last.x; ++x) {
+            const TileId tile = tiles_[static_cast<size_t>(y) * map_size_.x + x];
+            const TileDefinition* definition = get_tile_definition(tile);
+            if (!definition) continue;
+            row_has_tiles = true;
+            const sf::Texture* texture = tilesets_[tile >> 24]->texture;
+            if (texture != batch_texture) {
+                flush();
+                batch_texture = texture;
             }
 
-            auto& tile_info = tiles_[index];
-            
-            // 创建精灵的副本，避免修改原始精灵
-            sf::Sprite sprite = tile_info.sprite;
-            
-            // 计算位置（与原始render函数相同的逻辑）
-            sf::Vector2f tile_left_top_pos = {
-                static_cast<float>(x * tile_size_.x),
-                static_cast<float>(y * tile_size_.y)
+            // 高于瓦片的图块底部对齐
+            const sf::Vector2f size(definition->texture_rect.size);
+            const sf::Vector2f left_top = {
+                static_cast<float>((x - first.x) * tile_size_.x),
+                static_cast<float>((y - first.y) * row_pitch + top_margin + tile_size_.y) - size.y
             };
-            
-            // 处理高度调整 - 使用底部对齐
-            float sprite_height = sprite.getGlobalBounds().size.y;
-            if (static_cast<int>(sprite_height) != tile_size_.y) {
-                tile_left_top_pos.y -= (sprite_height - static_cast<float>(tile_size_.y));
-            }
-            
-            sprite.setPosition(tile_left_top_pos);
-            render_texture_.draw(sprite);
+            const sf::Vector2f uv(definition->texture_rect.position);
+            const sf::Vertex corners[4] = {
+                {left_top, sf::Color::White, uv},
+                {left_top + sf::Vector2f{size.x, 0.f}, sf::Color::White, uv + sf::Vector2f{size.x, 0.f}},
+                {left_top + sf::Vector2f{0.f, size.y}, sf::Color::White, uv + sf::Vector2f{0.f, size.y}},
+                {left_top + size, sf::Color::White, uv + size},
+            };
+            vertices.insert(vertices.end(), {corners[0], corners[2], corners[1], corners[1], corners[2], corners[3]});
+        }
+        if (row_sorted && row_has_tiles) {
+            chunk.sprites.emplace_back(chunk.texture->getTexture()
+                                     , sf::IntRect({0, (y - first.y) * row_pitch}, {static_cast<int>(size.x), row_pitch}));
         }
     }
+    flush();
+    chunk.texture->display();
 
-    // 完成绘制并更新纹理
-    render_texture_.display();
-    
-    // 创建或更新缓存的精灵
-    if (!cached_sprite_) {
-        cached_sprite_ = std::make_unique<sf::Sprite>(render_texture_.getTexture());
-    } else {
-        cached_sprite_->setTexture(render_texture_.getTexture());
+    if (!row_sorted) {
+        chunk.sprites.emplace_back(chunk.texture->getTexture());
+    }
+    spdlog::trace("TileLayerComponent: 块 ({}, {}) 重建完成，纹理大小: {}x{}", chunk_pos.x, chunk_pos.y, size.x, size.y);
+    return true;
+}
+
+void TileLayerComponent::release_chunk(Chunk& chunk) {
+    if (chunk.texture) --resident_chunks_;
+    chunk.sprites.clear();
+    chunk.fallback_sprites.clear();
+    // 纹理可能仍被正在提交的快照引用，交给渲染器在引用它的快照都提交之后释放
+    if (renderer_obs_) {
+        renderer_obs_->retire_texture(std::move(chunk.texture));
+        renderer_obs_->retire_texture(std::move(chunk.back_texture));
+    }
+    chunk.texture.reset();
+    chunk.back_texture.reset();
+}
+
+void TileLayerComponent::evict_unseen_chunks() {
+    for (auto& chunk : chunks_) {
+        if (chunk.texture && frame_ - chunk.last_seen_frame > CHUNK_EVICT_FRAMES) {
+            release_chunk(chunk);
+            chunk.dirty = true;
+        }
+    }
+}
+
+void TileLayerComponent::build_fallback_sprites(Chunk& chunk, sf::Vector2i chunk_pos) const {
+    const sf::Vector2i first = chunk_pos * CHUNK_SIZE;
+    const sf::Vector2i last = {std::min(first.x + CHUNK_SIZE, map_size_.x), std::min(first.y + CHUNK_SIZE, map_size_.y)};
+    chunk.fallback_sprites.clear();
+    for (int y = first.y; y < last.y; ++y) {
+        for (int x = first.x; x < last.x; ++x) {
+            const TileId tile = tiles_[static_cast<size_t>(y) * map_size_.x + x];
+            const TileDefinition* definition = get_tile_definition(tile);
+            if (!definition) continue;
+            auto& sprite = chunk.fallback_sprites.emplace_back(*tilesets_[tile >> 24]->texture, definition->texture_rect);
+            sprite.setPosition({offset_.x + static_cast<float>(x * tile_size_.x)
+                              , offset_.y + static_cast<float>((y + 1) * tile_size_.y - definition->texture_rect.size.y)});
+        }
     }
-    
-    cached_sprite_->setPosition(offset_);
-    
-    // 标记缓存为最新
-    cache_dirty_ = false;
-    
-    spdlog::debug("TileLayerComponent: 缓存重建完成，纹理大小: {}x{}", total_width, total_height);
 }
 
 void TileLayerComponent::render(engine::core::Context& context) {
     if (is_hidden_) return;
-    if (tile_size_.x <= 0 || tile_size_.y <= 0) {
-        spdlog::warn("TileLayerComponent: 无效瓦片尺寸！");
+    if (tile_size_.x <= 0 || tile_size_.y <= 0 || map_size_.x <= 0 || map_size_.y <= 0) {
+        spdlog::warn("TileLayerComponent: 无效的瓦片尺寸或地图尺寸");
         return;
     }
+    ++frame_;
+    renderer_obs_ = &context.get_renderer();
 
-    // 检查是否需要重建缓存
-    if (cache_dirty_ || !cached_sprite_) {
-        rebuild_cache();
+    const sf::Vector2i chunk_count = get_chunk_count();
+    if (chunks_.size() != static_cast<size_t>(chunk_count.x * chunk_count.y)) {
+        for (auto& chunk : chunks_) release_chunk(chunk);
+        chunks_.clear();
+        chunks_.resize(static_cast<size_t>(chunk_count.x * chunk_count.y));
+        resident_chunks_ = 0;
     }
 
-    // 如果缓存精灵有效，则绘制
-    if (cached_sprite_) {
-        context.get_renderer().draw_sprite(context.get_camera(), *cached_sprite_);
-    } else {
-        spdlog::warn("TileLayerComponent: 缓存精灵无效，回退到原始渲染");
-        // 回退到原始渲染方法
-        for (int y = 0; y < map_size_.y; y++) {
-            for (int x = 0; x < map_size_.x; x++) {
-                size_t index = static_cast<size_t>(y) * map_size_.x + x;
-                if (index < tiles_.size() && tiles_[index].type != TileType::Empty) {
-                    auto& tile_info = tiles_[index];
-                    sf::Vector2f tile_left_top_pos = {
-                        offset_.x + static_cast<float>(x) * tile_size_.x,
-                        offset_.y + static_cast<float>(y) * tile_size_.y
-                    };
-                    if (static_cast<int>(tile_info.sprite.getGlobalBounds().size.y) != tile_size_.y) {
-                        tile_left_top_pos.y -= (tile_info.sprite.getGlobalBounds().size.y - static_cast<float>(tile_size_.y));
-                    }
-                    tile_info.sprite.setPosition(tile_left_top_pos);
-                    context.get_renderer().draw_sprite(context.get_camera(), tile_info.sprite);
+    // 地面层直接绘制；其它层加入场景的渲染队列，按（层、y）与对象一起排序（y 取瓦片行的下边缘）
+    auto* scene = is_row_sorted() && owner_ ? owner_->get_scene() : nullptr;
+    auto draw = [&](sf::Sprite& sprite, float sort_y) {
+        if (scene) {
+            scene->get_render_queue().push(render_layer_, sort_y, sprite);
+        } else {
+            context.get_renderer().draw_sprite(context.get_camera(), sprite);
+        }
+    };
+
+    // 只处理与视口相交的块（块向右、向上扩展了瓦片精灵伸出的部分）
+    const sf::Vector2f chunk_world_size = {static_cast<float>(CHUNK_SIZE * tile_size_.x), static_cast<float>(CHUNK_SIZE * tile_size_.y)};
+    const auto& view = context.get_camera().get_world_view();
+    const sf::Vector2f view_min = view.getCenter() - view.getSize() * 0.5f - offset_;
+    const sf::Vector2f view_max = view.getCenter() + view.getSize() * 0.5f - offset_;
+    auto to_chunk = [](float value, float chunk_extent, int count) {
+        return static_cast<int>(std::clamp(std::floor(value / chunk_extent), -1.f, static_cast<float>(count)));
+    };
+    const int min_x = std::max(to_chunk(view_min.x - max_overhang_.x, chunk_world_size.x, chunk_count.x), 0);
+    const int max_x = std::min(to_chunk(view_max.x, chunk_world_size.x, chunk_count.x), chunk_count.x - 1);
+    const int min_y = std::max(to_chunk(view_min.y, chunk_world_size.y, chunk_count.y), 0);
+    const int max_y = std::min(to_chunk(view_max.y + max_overhang_.y, chunk_world_size.y, chunk_count.y), chunk_count.y - 1);
+
+    for (int cy = min_y; cy <= max_y; ++cy) {
+        for (int cx = min_x; cx <= max_x; ++cx) {
+            Chunk& chunk = chunks_[static_cast<size_t>(cy) * chunk_count.x + cx];
+            chunk.last_seen_frame = frame_;
+            if (chunk.dirty && !rebuild_chunk(chunk, {cx, cy})) {
+                // 缓存纹理创建失败，回退到逐个瓦片绘制（y 取每个瓦片的下边缘）
+                build_fallback_sprites(chunk, {cx, cy});
+                for (auto& sprite : chunk.fallback_sprites) {
+                    draw(sprite, sprite.getPosition().y + static_cast<float>(sprite.getTextureRect().size.y));
                 }
+                continue;
+            }
+            const sf::Vector2f chunk_pos = {offset_.x + static_cast<float>(cx) * chunk_world_size.x
+                                          , offset_.y + static_cast<float>(cy) * chunk_world_size.y};
+            const int row_pitch = get_row_pitch();
+            for (auto& sprite : chunk.sprites) {       // 空块没有精灵
+                // 地面层只有一个整块精灵（行号为 0）；排序层的精灵由纹理区域所在的条带得到行号
+                const int row = is_row_sorted() ? sprite.getTextureRect().position.y / row_pitch : 0;
+                const float row_top = chunk_pos.y + static_cast<float>(row * tile_size_.y);
+                sprite.setPosition({chunk_pos.x, row_top - std::ceil(max_overhang_.y)});
+                draw(sprite, row_top + static_cast<float>(tile_size_.y));
             }
         }
     }
+
+    if (frame_ % CHUNK_EVICT_CHECK_INTERVAL == 0) evict_unseen_chunks();
 }
-} // namespace engine::component
\ No newline at end of file
+} // namespace engine::component
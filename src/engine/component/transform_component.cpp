@@ -8,8 +8,21 @@ TransformComponent::TransformComponent(engine::object::GameObject* owner
                                      , sf::Vector2f origin)
     : Component{owner}
     , position_{std::move(position)}
+    , previous_position_{position_}
     , scale_{std::move(scale)}
     , angle_{std::move(angle)}
-    , origin_{std::move(origin)} {
+    , origin_{std::move(origin)}
+    , initial_position_{position_}
+    , initial_scale_{scale_}
+    , initial_angle_{angle_}
+    , initial_origin_{origin_} {
+    set_tick_phases({});    // 纯数据组件，不参与任何阶段
+}
+
+void TransformComponent::reset() {
+    position_ = previous_position_ = initial_position_;
+    scale_ = initial_scale_;
+    angle_ = initial_angle_;
+    origin_ = initial_origin_;
 }
 } // namespace engine::component
\ No newline at end of file
@@ -76,10 +76,17 @@ void Config::from_json(const nlohmann::json& json) {
     if (json.contains("graphics")) {
         const auto& graphics_config = json["graphics"];
         vsync_enabled_ = graphics_config.value("vsync", vsync_enabled_);
+        texture_atlas_enabled_ = graphics_config.value("texture_atlas", texture_atlas_enabled_);
+        atlas_page_size_ = graphics_config.value("atlas_page_size", atlas_page_size_);
+        atlas_sources_ = graphics_config.value("atlas_sources", atlas_sources_);
     }
     if (json.contains("performance")) {
         const auto& perf_config = json["performance"];
         target_fps_ = perf_config.value("target_fps", target_fps_);
+        max_updates_per_frame_ = perf_config.value("max_updates_per_frame", max_updates_per_frame_);
+        carry_over_lag_ = perf_config.value("carry_over_lag", carry_over_lag_);
+        pipelined_rendering_ = perf_config.value("pipelined_rendering", pipelined_rendering_);
+        worker_threads_ = perf_config.value("worker_threads", worker_threads_);
     }
     if (json.contains("audio")) {
         const auto& audio_config = json["audio"];
@@ -128,10 +135,17 @@ nlohmann::ordered_json Config::to_json() const {
             {"resizable", window_resizable_}
         }},
         {"graphics", {
-            {"vsync", vsync_enabled_}
+            {"vsync", vsync_enabled_},
+            {"texture_atlas", texture_atlas_enabled_},
+            {"atlas_page_size", atlas_page_size_},
+            {"atlas_sources", atlas_sources_}
         }},
         {"performance", {
-            {"target_fps", target_fps_}
+            {"target_fps", target_fps_},
+            {"max_updates_per_frame", max_updates_per_frame_},
+            {"carry_over_lag", carry_over_lag_},
+            {"pipelined_rendering", pipelined_rendering_},
+            {"worker_threads", worker_threads_}
         }},
         {"audio", {
             {"music_volume", music_volume_},
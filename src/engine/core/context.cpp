@@ -5,6 +5,9 @@
 #include "engine/resource/resource_manager.hpp"
 #include "engine/audio/audio_player.hpp"
 #include "engine/core/game_state.hpp"
+#include "engine/utils/profiler.hpp"
+#include "engine/core/time.hpp"
+#include "engine/core/job_system.hpp"
 #include "entt/signal/dispatcher.hpp"
 #include <spdlog/spdlog.h>
 
@@ -15,14 +18,20 @@ Context::Context(entt::dispatcher& dispatcher
                , engine::render::Camera& camera
                , engine::resource::ResourceManager& resource_manager
                , engine::audio::AudioPlayer& audio_player
-               , engine::core::GameState& game_state)
+               , engine::core::GameState& game_state
+               , engine::utils::Profiler& profiler
+               , engine::core::Time& time
+               , engine::core::JobSystem& job_system)
     : dispatcher_{dispatcher}
     , input_manager_{input_manager}
     , renderer_{renderer}
     , camera_{camera}
     , resource_manager_{resource_manager}
     , audio_player_{audio_player}
-    , game_state_{game_state} {
+    , game_state_{game_state}
+    , profiler_{profiler}
+    , time_{time}
+    , job_system_{job_system} {
     spdlog::trace("上下文已创建并初始化");
 }
 } // namespace engine::core
\ No newline at end of file
@@ -1,40 +1,57 @@
 #include "engine/core/game.hpp"
 #include "engine/utils/action.hpp"
 #include "engine/core/time.hpp"
+#include "engine/core/job_system.hpp"
 #include "engine/core/config.hpp"
 #include "engine/resource/resource_manager.hpp"
 #include "engine/input/input_manager.hpp"
+#include "engine/input/input_recorder.hpp"
 #include "engine/scene/scene_manager.hpp"
 #include "engine/render/render.hpp"
 #include "engine/render/camera.hpp"
+#include "engine/render/render_snapshot.hpp"
 #include "engine/object/game_object.hpp"
 #include "engine/audio/audio_player.hpp"
 #include "engine/core/game_state.hpp"
 #include "engine/core/context.hpp"
 #include "engine/utils/events.hpp"
+#include "engine/utils/profiler.hpp"
 #include "entt/signal/dispatcher.hpp"
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/System/Clock.hpp>
+#include <imgui.h>
+#include <imgui-SFML.h>
 #include <spdlog/spdlog.h>
+#include <array>
 
 namespace engine::core {
-Game::Game()
-    : config_{std::make_unique<Config>("assets/config.json")}
-    , window_{std::make_unique<sf::RenderWindow>(sf::VideoMode(config_->window_size_), config_->window_title_)}
+Game::Game(bool headless)
+    : headless_{headless}
+    , config_{std::make_unique<Config>("assets/config.json")}
+    , window_{headless_ ? nullptr : std::make_unique<sf::RenderWindow>(sf::VideoMode(config_->window_size_), config_->window_title_)}
+    , imgui_clock_{std::make_unique<sf::Clock>()}
     , dispatcher_{std::make_unique<entt::dispatcher>()}
     , time_{std::make_unique<Time>()}
+    , profiler_{std::make_unique<engine::utils::Profiler>()}
+    , job_system_{std::make_unique<JobSystem>(config_->worker_threads_)}
     , resource_manager_{std::make_unique<engine::resource::ResourceManager>()}
     , input_manager_{std::make_unique<engine::input::InputManager>(window_.get(), config_.get())}
     , renderer_{std::make_unique<engine::render::Renderer>(window_.get(), resource_manager_.get())}
-    , camera_{std::make_unique<engine::render::Camera>(window_.get())}
+    , camera_{headless_ ? std::make_unique<engine::render::Camera>(sf::Vector2f(config_->window_size_))
+                        : std::make_unique<engine::render::Camera>(window_.get())}
     , audio_player_{std::make_unique<engine::audio::AudioPlayer>(resource_manager_.get())}
-    , game_state_{std::make_unique<engine::core::GameState>(window_.get())}
+    , game_state_{headless_ ? std::make_unique<engine::core::GameState>(sf::Vector2f(config_->window_size_))
+                            : std::make_unique<engine::core::GameState>(window_.get())}
     , context_{std::make_unique<engine::core::Context>(*dispatcher_
                                                      , *input_manager_
                                                      , *renderer_
                                                      , *camera_
                                                      , *resource_manager_
                                                      , *audio_player_
-                                                     , *game_state_)}
+                                                     , *game_state_
+                                                     , *profiler_
+                                                     , *time_
+                                                     , *job_system_)}
     , scene_manager_{std::make_unique<engine::scene::SceneManager>(*context_)} {
     // 设置游戏音量（从 assets/config.json 里读取）
     audio_player_->set_music_volume(config_->music_volume_);    // 设置背景音乐音量
@@ -42,6 +59,24 @@ Game::Game()
 
     // 注册退出事件（回调函数可以无参数，代表不使用事件结构体中的数据）
     dispatcher_->sink<utils::QuitEvent>().connect<&Game::on_quit_event>(this);
+    input_manager_->on_action(Action::FastForward).connect<&Game::on_fast_forward>(this);
+
+    if (headless_) {
+        spdlog::info("Game 以无头模式启动：不创建窗口，不处理事件，不渲染");
+    } else {
+        // ImGui 只用于调试叠加层，失败时不影响游戏运行
+        imgui_initialized_ = ImGui::SFML::Init(*window_);
+        if (imgui_initialized_) {
+            ImGui::GetIO().IniFilename = nullptr;       // 不生成 imgui.ini
+        } else {
+            spdlog::warn("ImGui-SFML 初始化失败，性能分析叠加层不可用");
+        }
+
+        // 在加载任何场景之前打包图集，之后蓝图等通过 load_texture_region 取得图集中的区域
+        if (config_->texture_atlas_enabled_) {
+            resource_manager_->build_texture_atlas(config_->atlas_sources_, config_->atlas_page_size_);
+        }
+    }
 }
 
 Game::~Game() {
@@ -49,32 +84,217 @@ Game::~Game() {
 
     // 断开事件处理函数
     dispatcher_->sink<utils::QuitEvent>().disconnect<&Game::on_quit_event>(this);
+    input_manager_->on_action(Action::FastForward).disconnect<&Game::on_fast_forward>(this);
+
+    stop_recording();
+
+    if (imgui_initialized_) ImGui::SFML::Shutdown();
 }
 
 void Game::run() {
+    if (headless_) {
+        spdlog::error("Game::run 需要窗口，无头模式请使用 run_headless");
+        return;
+    }
+
     // 调用场景设置函数(创建第一个场景并压入栈)
     scene_setup_func_(*context_);
 
     time_->set_target_fps(config_->target_fps_);
+    time_->set_max_updates_per_frame(config_->max_updates_per_frame_);
+    time_->set_carry_over_lag(config_->carry_over_lag_);
+
+    if (config_->pipelined_rendering_) {
+        run_pipelined();
+    } else {
+        while (is_running_ && window_->isOpen()) {
+            // --- 输入帧开始 ---
+            input_manager_->begin_frame();
+
+            {
+                ENGINE_PROFILE_ZONE(*profiler_, "Game::handle_event");
+                handle_event();
+            }
+
+            // --- 固定步长更新 ---
+            fixed_update();
+
+            // --- 输入帧结束 ---
+            input_manager_->end_frame();
+
+            {
+                ENGINE_PROFILE_ZONE(*profiler_, "Game::render");
+                render();
+            }
+
+            profiler_->end_frame();
+        }
+    }
+
+    stop_recording();
+    if (window_->isOpen()) window_->close();
+}
+
+void Game::run_pipelined() {
+    spdlog::info("Game 以流水线模式运行：模拟线程更新第 N+1 帧时，主线程提交第 N 帧");
 
-    while (window_->isOpen()) {
-        // --- 输入帧开始 ---
+    // 双缓冲快照：front 由主线程提交，back 由模拟线程录制
+    std::array<engine::render::RenderSnapshot, 2> snapshots;
+    std::size_t front = 0;
+
+    // 先串行录制第一帧，之后每帧都有一个可提交的快照
+    input_manager_->begin_frame();
+    poll_events();
+    simulate_and_record(snapshots[front]);
+
+    while (is_running_ && window_->isOpen()) {
+        // --- 模拟线程空闲：在主线程处理窗口事件 ---
         input_manager_->begin_frame();
+        {
+            ENGINE_PROFILE_ZONE(*profiler_, "Game::handle_event");
+            poll_events();
+        }
+
+        // --- 在共享线程池中模拟下一帧，同时提交当前帧 ---
+        auto& back = snapshots[1 - front];
+        auto simulation = job_system_->schedule([this, &back] { simulate_and_record(back); });
+        {
+            ENGINE_PROFILE_ZONE(*profiler_, "Game::render");
+            window_->clear();
+            renderer_->submit(snapshots[front]);
+            present();
+        }
+        {
+            ENGINE_PROFILE_ZONE(*profiler_, "Game::wait_simulation");
+            job_system_->wait(simulation);      // 模拟中抛出的异常会在这里重新抛出
+        }
+
+        front = 1 - front;
+        profiler_->end_frame();
+    }
+}
+
+void Game::simulate_and_record(engine::render::RenderSnapshot& snapshot) {
+    {
+        ENGINE_PROFILE_ZONE(*profiler_, "SceneManager::handle_input");
+        scene_manager_->handle_input();
+    }
+
+    fixed_update();
+
+    input_manager_->end_frame();
 
-        handle_event();
+    ENGINE_PROFILE_ZONE(*profiler_, "Game::record_render");
+    renderer_->begin_recording(snapshot);
+    scene_manager_->render();
+    renderer_->end_recording();
+}
 
-        // --- 固定步长更新 ---
-        time_->accumulate_frame_time();
-        while (time_->should_update()) {
-            time_->consume_update_time();
+void Game::fixed_update() {
+    if (player_) {
+        // 回放：执行与录制时完全相同的更新次数，不依赖真实时间
+        ENGINE_PROFILE_ZONE(*profiler_, "Game::fixed_step_loop");
+        for (std::uint64_t i = 0; i < player_->get_frame_steps(); ++i) {
+            ENGINE_PROFILE_ZONE(*profiler_, "Game::update");
             update(time_->get_frame_duration());
         }
+        return;
+    }
 
-        // --- 输入帧结束 ---
-        input_manager_->end_frame();
+    time_->accumulate_frame_time();
 
-        render();
+    ENGINE_PROFILE_ZONE(*profiler_, "Game::fixed_step_loop");
+    sf::Clock update_clock;
+    while (time_->should_update()) {
+        time_->consume_update_time();
+        ENGINE_PROFILE_ZONE(*profiler_, "Game::update");
+        update(time_->get_frame_duration());
     }
+    time_->report_update_cost(update_clock.getElapsedTime());
+}
+
+double Game::run_headless(std::uint64_t ticks) {
+    if (!headless_) {
+        spdlog::error("Game::run_headless 只能在无头模式下调用");
+        return 0.0;
+    }
+    if (!scene_setup_func_) {
+        spdlog::error("Game::run_headless 未注册场景设置函数");
+        return 0.0;
+    }
+
+    // 调用场景设置函数(创建第一个场景并压入栈)
+    scene_setup_func_(*context_);
+
+    // 目标帧率为 0 表示不限帧，但固定步长仍需要一个有效值，回退到 60
+    time_->set_target_fps(config_->target_fps_ > 0 ? static_cast<float>(config_->target_fps_) : 60.f);
+    const sf::Time step = time_->get_frame_duration();
+
+    // --- 固定步长更新，不等待真实时间 ---
+    std::uint64_t done = 0;
+    sf::Clock wall_clock;
+    if (player_) {
+        // 回放：按录制时的帧结构注入事件，直到回放结束或达到 ticks
+        while (is_running_ && done < ticks) {
+            input_manager_->begin_frame();
+            poll_events();
+            scene_manager_->handle_input();
+            for (std::uint64_t i = 0; i < player_->get_frame_steps() && done < ticks; ++i, ++done) {
+                ENGINE_PROFILE_ZONE(*profiler_, "Game::update");
+                update(step);
+            }
+            input_manager_->end_frame();
+            profiler_->end_frame();
+        }
+    } else {
+        while (is_running_ && done < ticks) {
+            // 无头模式没有输入事件：录制时每次更新记为一个空闲帧，回放时按相同的帧结构执行
+            if (recorder_) recorder_->begin_frame(tick_);
+            {
+                ENGINE_PROFILE_ZONE(*profiler_, "Game::update");
+                update(step);
+            }
+            profiler_->end_frame();
+            ++done;
+        }
+    }
+    const float elapsed = wall_clock.getElapsedTime().asSeconds();
+    stop_recording();
+
+    const double ticks_per_second = elapsed > 0.f ? static_cast<double>(done) / elapsed : 0.0;
+    spdlog::info("无头模式运行结束：{} 次更新，耗时 {:.3f} 秒，吞吐量 {:.1f} ticks/s（模拟 {:.1f} 秒）",
+                 done, elapsed, ticks_per_second, done * step.asSeconds());
+    return ticks_per_second;
+}
+
+void Game::start_recording(std::string_view filepath) {
+    // 目标帧率可能尚未设置，这里按配置计算固定步长，仅用于回放时校验
+    const float fps = config_->target_fps_ > 0 ? static_cast<float>(config_->target_fps_) : 60.f;
+    recorder_ = std::make_unique<engine::input::InputRecorder>(static_cast<std::int64_t>(1.0e6f / fps));
+    record_path_ = filepath;
+    // 第一帧先记录窗口大小，回放时（包括无头回放）按录制时的窗口大小换算鼠标逻辑坐标
+    recorder_->begin_frame(tick_);
+    recorder_->record(sf::Event::Resized{window_ ? window_->getSize() : config_->window_size_});
+    spdlog::info("开始录制输入，将保存到 '{}'", record_path_);
+}
+
+bool Game::start_replay(std::string_view filepath) {
+    auto player = std::make_unique<engine::input::InputPlayer>();
+    if (!player->load_from_file(filepath)) return false;
+
+    const float fps = config_->target_fps_ > 0 ? static_cast<float>(config_->target_fps_) : 60.f;
+    if (player->get_fixed_step_us() != static_cast<std::int64_t>(1.0e6f / fps)) {
+        spdlog::warn("录制时的固定步长（{} us）与当前配置不同，回放结果可能不一致", player->get_fixed_step_us());
+    }
+    player_ = std::move(player);
+    input_manager_->set_replaying(true);
+    return true;
+}
+
+void Game::stop_recording() {
+    if (!recorder_) return;
+    recorder_->save_to_file(record_path_, tick_);
+    recorder_.reset();
 }
 
 void Game::register_scene_setup(std::function<void(engine::core::Context&)> func) {
@@ -83,19 +303,59 @@ void Game::register_scene_setup(std::function<void(engine::core::Context&)> func
 }
 
 void Game::handle_event() {
-    while (std::optional event = window_->pollEvent()) {
-        input_manager_->handle_event(*event);
+    poll_events();
+    scene_manager_->handle_input();
+}
+
+void Game::poll_events() {
+    if (recorder_) recorder_->begin_frame(tick_);
+
+    // 模拟线程此时空闲：把 UI 视图大小交给 InputManager，模拟线程换算鼠标逻辑坐标时不再读取窗口
+    input_manager_->set_logical_size(camera_->get_ui_view_size());
+
+    if (player_) {
+        if (!player_->next_frame(replay_events_)) {
+            spdlog::info("输入回放结束（共 {} 次更新）", tick_);
+            is_running_ = false;
+        }
+        for (const auto& event : replay_events_) {
+            dispatch_event(event);
+        }
+        // 回放时仍然轮询窗口保持响应，但只响应关闭
+        if (window_) {
+            while (std::optional event = window_->pollEvent()) {
+                if (event->is<sf::Event::Closed>()) is_running_ = false;
+            }
+        }
+    } else if (window_) {
+        while (std::optional event = window_->pollEvent()) {
+            dispatch_event(*event);
+        }
     }
 
     if (input_manager_->should_quit()) {
         spdlog::trace("Game 收到来自 InputManager 的退出请求。");
-        window_->close();
+        if (window_) window_->close();
+        is_running_ = false;
     }
+}
 
-    scene_manager_->handle_input();
+void Game::dispatch_event(const sf::Event& event) {
+    if (imgui_initialized_) ImGui::SFML::ProcessEvent(*window_, event);
+
+    // --- 性能分析叠加层切换 ---
+    if (auto key = event.getIf<sf::Event::KeyPressed>(); key && key->scancode == sf::Keyboard::Scan::F3) {
+        show_profiler_ = !show_profiler_;
+        profiler_->set_enabled(show_profiler_);
+    }
+
+    if (recorder_) recorder_->record(event);
+    input_manager_->handle_event(event);
 }
 
 void Game::update(sf::Time delta) {
+    ++tick_;
+
     // 游戏逻辑更新
     scene_manager_->update(delta);
 
@@ -107,12 +367,32 @@ void Game::render() {
     window_->clear();
 
     scene_manager_->render();
+    renderer_->flush();
+
+    present();
+}
+
+void Game::present() {
+    // ImGui 的帧时间需要每帧都消耗掉，即使叠加层没有显示
+    const sf::Time imgui_delta = imgui_clock_->restart();
+
+    // 调试叠加层绘制在最上层
+    if (imgui_initialized_ && show_profiler_) {
+        ImGui::SFML::Update(*window_, imgui_delta);
+        profiler_->draw_overlay();
+        ImGui::SFML::Render(*window_);
+    }
 
     window_->display();
 }
 
+void Game::on_fast_forward() {
+    time_->cycle_fast_forward();
+}
+
 void engine::core::Game::on_quit_event() {
     spdlog::trace("Game 收到来自事件分发器的退出请求");
-    window_->close();
+    // 可能在模拟线程上触发，这里只设置标志，由主线程在循环结束后关闭窗口
+    is_running_ = false;
 }
 } // namespace engine::core
\ No newline at end of file
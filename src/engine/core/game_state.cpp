@@ -13,6 +13,12 @@ GameState::GameState(sf::RenderWindow* window, State initial_state)
     spdlog::trace("游戏状态初始化完成");
 }
 
+GameState::GameState(sf::Vector2f logical_size, State initial_state)
+    : current_state_{initial_state}
+    , headless_logical_size_{std::move(logical_size)} {
+    spdlog::trace("游戏状态初始化完成（无头模式）");
+}
+
 void GameState::set_state(State new_state) {
     if (current_state_ != new_state) {
         spdlog::debug("游戏状态改变");
@@ -23,18 +29,28 @@ void GameState::set_state(State new_state) {
 }
 
 sf::Vector2u GameState::get_window_size() const {
+    if (!window_obs_) return sf::Vector2u(headless_logical_size_);
     return window_obs_->getSize();
 }
 
 void GameState::set_window_size(sf::Vector2u new_size) {
+    if (!window_obs_) {
+        headless_logical_size_ = sf::Vector2f(new_size);
+        return;
+    }
     window_obs_->setSize(new_size);
 }
 
 sf::Vector2f GameState::get_logical_size() const {
+    if (!window_obs_) return headless_logical_size_;
     return window_obs_->getView().getSize();
 }
 
 void GameState::set_logical_size(sf::Vector2f new_size) {
+    if (!window_obs_) {
+        headless_logical_size_ = new_size;
+        return;
+    }
     const auto& view = window_obs_->getView();
     window_obs_->setView({view.getCenter(), new_size});
     spdlog::trace("逻辑分辨率设置为: {}x{}", new_size.x, new_size.y);
@@ -0,0 +1,238 @@
+#include "engine/core/job_system.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <exception>
+#include <optional>
+
+namespace engine::core {
+/**
+ * @brief 一个任务（或一组 parallel_for 子任务）的完成计数器
+ */
+struct JobSystem::Counter {
+    explicit Counter(std::size_t count) : remaining{count} {}
+
+    std::atomic<std::size_t> remaining;                         ///< @brief 未完成的任务数
+    std::mutex mutex;                                           ///< @brief 保护以下成员
+    bool done = false;                                          ///< @brief 是否已完成（continuations 已触发）
+    std::vector<std::function<void()>> continuations;           ///< @brief 完成后需要执行的回调（依赖它的任务）
+    std::exception_ptr error;                                   ///< @brief 第一个抛出的异常
+};
+
+namespace {
+constexpr std::size_t NOT_A_WORKER = static_cast<std::size_t>(-1);
+
+thread_local const JobSystem* t_owner = nullptr;                // 当前线程所属的线程池
+thread_local std::size_t t_worker_index = NOT_A_WORKER;         // 当前线程在线程池中的下标
+} // namespace
+
+bool JobSystem::JobHandle::is_done() const {
+    return !counter_ || counter_->remaining.load(std::memory_order_acquire) == 0;
+}
+
+JobSystem::JobSystem(unsigned int worker_count) {
+    if (worker_count == 0) {
+        const unsigned int hardware = std::thread::hardware_concurrency();
+        worker_count = std::max(1u, hardware > 1 ? hardware - 1 : 1u);    // 主线程也会参与执行
+    }
+
+    queues_.reserve(worker_count);
+    for (unsigned int i = 0; i < worker_count; ++i) {
+        queues_.push_back(std::make_unique<WorkerQueue>());
+    }
+    workers_.reserve(worker_count);
+    for (unsigned int i = 0; i < worker_count; ++i) {
+        workers_.emplace_back([this, i] { worker_loop(i); });
+    }
+    spdlog::trace("JobSystem 初始化完成，工作线程数：{}", worker_count);
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard lock(sleep_mutex_);
+        stopping_ = true;
+    }
+    sleep_cv_.notify_all();
+    workers_.clear();           // 显式 join，保证工作线程在其他成员销毁前退出
+    spdlog::trace("JobSystem 已停止");
+}
+
+JobSystem::JobHandle JobSystem::schedule(std::function<void()> job, std::initializer_list<JobHandle> dependencies) {
+    return schedule(std::move(job), std::span<const JobHandle>(dependencies.begin(), dependencies.size()));
+}
+
+JobSystem::JobHandle JobSystem::schedule(std::function<void()> job, std::span<const JobHandle> dependencies) {
+    auto counter = std::make_shared<Counter>(1);
+    std::vector<Job> jobs;
+    jobs.push_back(Job{std::move(job), counter});
+    submit(std::move(jobs), dependencies);
+    return JobHandle{std::move(counter)};
+}
+
+JobSystem::JobHandle JobSystem::parallel_for(std::size_t begin
+                                           , std::size_t end
+                                           , std::size_t grain_size
+                                           , std::function<void(std::size_t, std::size_t)> body
+                                           , std::initializer_list<JobHandle> dependencies) {
+    if (begin >= end) return JobHandle{};
+
+    const std::size_t count = end - begin;
+    if (grain_size == 0) {
+        // 每个线程（含调用线程）大约分到 4 块，兼顾负载均衡与调度开销
+        const std::size_t chunks = (workers_.size() + 1) * 4;
+        grain_size = std::max<std::size_t>(1, (count + chunks - 1) / chunks);
+    }
+    const std::size_t chunk_count = (count + grain_size - 1) / grain_size;
+
+    auto counter = std::make_shared<Counter>(chunk_count);
+    auto shared_body = std::make_shared<std::function<void(std::size_t, std::size_t)>>(std::move(body));
+    std::vector<Job> jobs;
+    jobs.reserve(chunk_count);
+    for (std::size_t first = begin; first < end; first += grain_size) {
+        const std::size_t last = std::min(end, first + grain_size);
+        jobs.push_back(Job{[shared_body, first, last] { (*shared_body)(first, last); }, counter});
+    }
+    submit(std::move(jobs), std::span<const JobHandle>(dependencies.begin(), dependencies.size()));
+    return JobHandle{std::move(counter)};
+}
+
+void JobSystem::wait(const JobHandle& handle) {
+    if (!handle.counter_) return;
+    auto& counter = *handle.counter_;
+    const bool is_worker = t_owner == this;
+    const std::size_t preferred = is_worker ? t_worker_index : NOT_A_WORKER;
+
+    while (true) {
+        const std::size_t remaining = counter.remaining.load(std::memory_order_acquire);
+        if (remaining == 0) break;
+        if (try_run_one(preferred)) continue;
+
+        // 没有可帮忙的任务：工作线程让出时间片（避免所有工作线程都阻塞导致死锁），其他线程阻塞等待
+        if (is_worker) {
+            std::this_thread::yield();
+        } else {
+            counter.remaining.wait(remaining, std::memory_order_acquire);
+        }
+    }
+
+    std::exception_ptr error;
+    {
+        std::lock_guard lock(counter.mutex);
+        error = counter.error;
+    }
+    if (error) std::rethrow_exception(error);
+}
+
+void JobSystem::worker_loop(std::size_t index) {
+    t_owner = this;
+    t_worker_index = index;
+
+    while (true) {
+        if (try_run_one(index)) continue;
+
+        std::unique_lock lock(sleep_mutex_);
+        sleep_cv_.wait(lock, [this] { return stopping_ || queued_jobs_.load(std::memory_order_acquire) > 0; });
+        if (stopping_ && queued_jobs_.load(std::memory_order_acquire) == 0) return;
+    }
+}
+
+void JobSystem::submit(std::vector<Job> jobs, std::span<const JobHandle> dependencies) {
+    std::vector<std::shared_ptr<Counter>> pending_dependencies;
+    for (const auto& dependency : dependencies) {
+        if (!dependency.is_done()) pending_dependencies.push_back(dependency.counter_);
+    }
+
+    if (pending_dependencies.empty()) {
+        for (auto& job : jobs) enqueue(std::move(job));
+        return;
+    }
+
+    // 最后一个完成的依赖负责把任务入队
+    auto pending = std::make_shared<std::atomic<std::size_t>>(pending_dependencies.size());
+    auto shared_jobs = std::make_shared<std::vector<Job>>(std::move(jobs));
+    for (const auto& dependency : pending_dependencies) {
+        when_done(dependency, [this, pending, shared_jobs] {
+            if (pending->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                for (auto& job : *shared_jobs) enqueue(std::move(job));
+            }
+        });
+    }
+}
+
+void JobSystem::enqueue(Job job) {
+    const std::size_t index = t_owner == this ? t_worker_index
+                                              : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    {
+        std::lock_guard lock(queues_[index]->mutex);
+        queues_[index]->jobs.push_back(std::move(job));
+    }
+    queued_jobs_.fetch_add(1, std::memory_order_release);
+    {
+        std::lock_guard lock(sleep_mutex_);     // 与 worker_loop 的检查同步，避免丢失唤醒
+    }
+    sleep_cv_.notify_one();
+}
+
+bool JobSystem::try_run_one(std::size_t preferred) {
+    std::optional<Job> job;
+
+    // 先从自己的队列尾部取（最近提交，缓存最热）
+    if (preferred < queues_.size()) {
+        auto& queue = *queues_[preferred];
+        std::lock_guard lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            job.emplace(std::move(queue.jobs.back()));
+            queue.jobs.pop_back();
+        }
+    }
+
+    // 再从其他队列头部窃取
+    if (!job) {
+        const std::size_t start = preferred < queues_.size() ? preferred + 1 : 0;
+        for (std::size_t i = 0; i < queues_.size() && !job; ++i) {
+            auto& queue = *queues_[(start + i) % queues_.size()];
+            std::lock_guard lock(queue.mutex);
+            if (!queue.jobs.empty()) {
+                job.emplace(std::move(queue.jobs.front()));
+                queue.jobs.pop_front();
+            }
+        }
+    }
+
+    if (!job) return false;
+    queued_jobs_.fetch_sub(1, std::memory_order_acq_rel);
+
+    try {
+        job->func();
+    } catch (...) {
+        std::lock_guard lock(job->counter->mutex);
+        if (!job->counter->error) job->counter->error = std::current_exception();
+    }
+    finish(*job);
+    return true;
+}
+
+void JobSystem::finish(Job& job) {
+    auto& counter = *job.counter;
+    if (counter.remaining.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+    std::vector<std::function<void()>> continuations;
+    {
+        std::lock_guard lock(counter.mutex);
+        counter.done = true;
+        continuations.swap(counter.continuations);
+    }
+    counter.remaining.notify_all();
+    for (auto& continuation : continuations) continuation();
+}
+
+void JobSystem::when_done(const std::shared_ptr<Counter>& counter, std::function<void()> continuation) {
+    {
+        std::lock_guard lock(counter->mutex);
+        if (!counter->done) {
+            counter->continuations.push_back(std::move(continuation));
+            return;
+        }
+    }
+    continuation();
+}
+} // namespace engine::core
@@ -1,19 +1,58 @@
 #include "engine/core/time.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <bit>
 
 namespace engine::core {
+namespace {
+constexpr unsigned int MAX_FAST_FORWARD = 8;                // 最大快进倍率
+constexpr float UPDATE_BUDGET_RATIO = 0.75f;                // 更新可占用的帧时间比例（剩余留给渲染）
+constexpr unsigned int OVER_BUDGET_FRAMES_TO_SLOW_DOWN = 3; // 连续超预算多少帧后降档（忽略偶发尖峰）
+} // namespace
+
 const sf::Time& Time::get_frame_duration() const {
     return this->time_per_frame_;
 }
 
 void Time::set_time_scale(float scale) {
-    this->time_scale_ = scale;
-    this->time_per_frame_ *= scale;
+    this->time_scale_ = std::max(scale, 0.f);
 }
 
-float Time::get_time_scale() {
+float Time::get_time_scale() const {
     return this->time_scale_;
 }
 
+void Time::set_fast_forward(unsigned int speed) {
+    speed = std::clamp(speed, 1u, MAX_FAST_FORWARD);
+    speed = std::bit_floor(speed);
+    if (speed == fast_forward_) return;
+
+    fast_forward_ = speed;
+    over_budget_frames_ = 0;
+    spdlog::info("游戏速度：{}x", fast_forward_);
+}
+
+unsigned int Time::get_fast_forward() const {
+    return this->fast_forward_;
+}
+
+void Time::cycle_fast_forward() {
+    set_fast_forward(fast_forward_ >= MAX_FAST_FORWARD ? 1u : fast_forward_ * 2u);
+}
+
+void Time::report_update_cost(sf::Time cost) {
+    if (fast_forward_ == 1) return;
+
+    if (cost > time_per_frame_ * UPDATE_BUDGET_RATIO) {
+        if (++over_budget_frames_ >= OVER_BUDGET_FRAMES_TO_SLOW_DOWN) {
+            spdlog::warn("快进 {}x 超出帧预算（更新耗时 {:.2f} ms），自动降速", fast_forward_, cost.asSeconds() * 1000.f);
+            set_fast_forward(fast_forward_ / 2u);
+        }
+    } else {
+        over_budget_frames_ = 0;
+    }
+}
+
 void Time::set_target_fps(float fps) {
     this->TAEGET_FPS = fps;
     this->time_per_frame_ = sf::seconds(1.f / TAEGET_FPS);
@@ -23,15 +62,48 @@ float Time::get_target_fps() const {
     return this->TAEGET_FPS;
 }
 
+void Time::set_max_updates_per_frame(unsigned int max_updates) {
+    this->max_updates_per_frame_ = max_updates;
+}
+
+unsigned int Time::get_max_updates_per_frame() const {
+    return this->max_updates_per_frame_;
+}
+
+void Time::set_carry_over_lag(bool carry_over) {
+    this->carry_over_lag_ = carry_over;
+}
+
 void Time::accumulate_frame_time() {
-    elapsed_time += clock_.restart();
+    // 缩放的是真实时间而不是步长：快进时每帧执行更多次同样大小的更新，保证模拟结果确定
+    elapsed_time += clock_.restart() * (time_scale_ * static_cast<float>(fast_forward_));
+    updates_this_frame_ = 0;
+
+    // 丢弃模式下，超过本帧能追赶的部分直接舍弃
+    if (!carry_over_lag_ && max_updates_per_frame_ > 0) {
+        const sf::Time max_elapsed = time_per_frame_ * static_cast<float>(max_updates_per_frame_ * fast_forward_);
+        if (elapsed_time > max_elapsed) {
+            spdlog::debug("帧时间过长，丢弃 {:.1f} ms 的积压时间", (elapsed_time - max_elapsed).asSeconds() * 1000.f);
+            elapsed_time = max_elapsed;
+        }
+    }
 }
 
 bool Time::should_update() const {
-    return elapsed_time > time_per_frame_;
+    // 更新上限随快进倍率放大，否则快进会被上限吃掉
+    if (max_updates_per_frame_ > 0 && updates_this_frame_ >= max_updates_per_frame_ * fast_forward_) {
+        return false;
+    }
+    return elapsed_time >= time_per_frame_;
 }
 
 void Time::consume_update_time() {
     elapsed_time -= time_per_frame_;
+    ++updates_this_frame_;
+}
+
+float Time::get_interpolation_alpha() const {
+    if (time_per_frame_ <= sf::Time::Zero) return 1.f;
+    return std::clamp(elapsed_time / time_per_frame_, 0.f, 1.f);
 }
 } // namespace engine::core
\ No newline at end of file
@@ -9,7 +9,9 @@ namespace engine::input {
 
 InputManager::InputManager(sf::RenderWindow* window, const engine::core::Config* config)
     : window_obs_{window}
-    , action_to_input_copy_{config->action_to_input_} {
+    , action_to_input_copy_{config->action_to_input_}
+    , window_size_{window ? window->getSize() : config->window_size_}
+    , logical_size_{sf::Vector2f(config->window_size_)} {
 
     for (const auto& [action, _] : action_to_input_copy_) {
         action_states_.emplace(action, ActionState::Inactive);
@@ -38,10 +40,15 @@ void InputManager::begin_frame() {
 void InputManager::handle_event(const sf::Event& event) {
     // --- 窗口关闭 ---
     if (event.is<sf::Event::Closed>()) {
-        window_obs_->close();
+        if (window_obs_) window_obs_->close();
         return;
     }
 
+    // --- 窗口大小改变（回放时同样更新，换算鼠标逻辑坐标与录制时一致） ---
+    if (auto resized = event.getIf<sf::Event::Resized>(); resized) {
+        window_size_ = resized->size;
+    }
+
     // --- 全屏切换 ---
     if (auto key = event.getIf<sf::Event::KeyPressed>(); key) {
         if (key->scancode == sf::Keyboard::Scan::F11) {
@@ -61,13 +68,20 @@ void InputManager::handle_event(const sf::Event& event) {
 
     // --- 鼠标按下 ---
     if (auto mouse = event.getIf<sf::Event::MouseButtonPressed>(); mouse) {
+        last_event_mouse_position_ = mouse->position;
         update(mouse->button, true);
     }
 
     // --- 鼠标释放 ---
     if (auto mouse = event.getIf<sf::Event::MouseButtonReleased>(); mouse) {
+        last_event_mouse_position_ = mouse->position;
         update(mouse->button, false);
     }
+
+    // --- 鼠标移动（用于换算鼠标逻辑坐标，回放时用于还原鼠标位置） ---
+    if (auto mouse = event.getIf<sf::Event::MouseMoved>(); mouse) {
+        last_event_mouse_position_ = mouse->position;
+    }
 }
 
 void InputManager::end_frame() {
@@ -84,6 +98,7 @@ void InputManager::end_frame() {
 // === 内部工具 ===
 
 void InputManager::toggle_fullscreen() {
+    if (!window_obs_) return;
     window_obs_->close();
 
     if (is_full_screen_) {
@@ -92,6 +107,7 @@ void InputManager::toggle_fullscreen() {
         window_obs_->create(sf::VideoMode::getDesktopMode(), "Sunny Land", sf::State::Fullscreen);
     }
 
+    window_size_ = window_obs_->getSize();
     is_full_screen_ = !is_full_screen_;
 }
 
@@ -121,18 +137,23 @@ bool InputManager::is_action_released(Action action) const {
 // === 鼠标位置 ===
 
 sf::Vector2i InputManager::get_mouse_position() const {
+    if (replaying_) return last_event_mouse_position_;
     return sf::Mouse::getPosition();
 }
 
 sf::Vector2i InputManager::get_mouse_position_window() const {
+    if (replaying_) return last_event_mouse_position_;
+    if (!window_obs_) return {0, 0};
     return sf::Mouse::getPosition(*window_obs_);
 }
 
 sf::Vector2i InputManager::get_mouse_logical_position() const {
-    const sf::View& view = window_obs_->getView();
-    sf::Vector2i mouse_position = get_mouse_position_window();
-    sf::Vector2f scale = view.getSize().componentWiseDiv(static_cast<sf::Vector2f>(window_obs_->getSize()));
-    sf::Vector2f logical_position = static_cast<sf::Vector2f>(mouse_position).componentWiseMul(scale);
+    // 流水线模式下本函数在模拟线程调用，而主线程正在向窗口提交上一帧：
+    // 鼠标位置取自事件，窗口与视图大小都使用主线程写入的副本，不访问窗口。
+    // 有窗口、无头、回放三种情况使用同一套换算（回放时窗口大小来自录制的 Resized 事件）
+    if (window_size_.x == 0 || window_size_.y == 0) return last_event_mouse_position_;
+    sf::Vector2f scale = logical_size_.componentWiseDiv(static_cast<sf::Vector2f>(window_size_));
+    sf::Vector2f logical_position = static_cast<sf::Vector2f>(last_event_mouse_position_).componentWiseMul(scale);
     return static_cast<sf::Vector2i>(logical_position);
 }
 } // namespace engine::input
\ No newline at end of file
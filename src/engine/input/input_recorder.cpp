@@ -0,0 +1,349 @@
+#include "engine/input/input_recorder.hpp"
+#include <spdlog/spdlog.h>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string>
+
+namespace engine::input {
+namespace {
+/// @brief 事件类型在文件中的编号（只能追加，不能修改已有编号）
+enum class EventType : std::uint8_t {
+    Closed,
+    Resized,
+    FocusLost,
+    FocusGained,
+    TextEntered,
+    KeyPressed,
+    KeyReleased,
+    MouseWheelScrolled,
+    MouseButtonPressed,
+    MouseButtonReleased,
+    MouseMoved,
+    MouseEntered,
+    MouseLeft
+};
+
+// --- 编码 ---
+
+void write_varint(std::vector<std::uint8_t>& out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+/// @brief 有符号数先做 zigzag 变换，使绝对值小的负数也只占 1 字节
+void write_signed(std::vector<std::uint8_t>& out, std::int64_t value) {
+    write_varint(out, (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+}
+
+void write_position(std::vector<std::uint8_t>& out, sf::Vector2i position) {
+    write_signed(out, position.x);
+    write_signed(out, position.y);
+}
+
+template <typename KeyEvent>
+void write_key(std::vector<std::uint8_t>& out, const KeyEvent& key) {
+    write_signed(out, static_cast<std::int64_t>(key.code));
+    write_signed(out, static_cast<std::int64_t>(key.scancode));
+    out.push_back(static_cast<std::uint8_t>((key.alt ? 1 : 0) | (key.control ? 2 : 0) | (key.shift ? 4 : 0) | (key.system ? 8 : 0)));
+}
+
+void write_event(std::vector<std::uint8_t>& out, const sf::Event& event) {
+    auto put_type = [&out](EventType type) { out.push_back(static_cast<std::uint8_t>(type)); };
+
+    if (event.is<sf::Event::Closed>()) {
+        put_type(EventType::Closed);
+    } else if (auto resized = event.getIf<sf::Event::Resized>()) {
+        put_type(EventType::Resized);
+        write_varint(out, resized->size.x);
+        write_varint(out, resized->size.y);
+    } else if (event.is<sf::Event::FocusLost>()) {
+        put_type(EventType::FocusLost);
+    } else if (event.is<sf::Event::FocusGained>()) {
+        put_type(EventType::FocusGained);
+    } else if (auto text = event.getIf<sf::Event::TextEntered>()) {
+        put_type(EventType::TextEntered);
+        write_varint(out, static_cast<std::uint32_t>(text->unicode));
+    } else if (auto key = event.getIf<sf::Event::KeyPressed>()) {
+        put_type(EventType::KeyPressed);
+        write_key(out, *key);
+    } else if (auto key = event.getIf<sf::Event::KeyReleased>()) {
+        put_type(EventType::KeyReleased);
+        write_key(out, *key);
+    } else if (auto wheel = event.getIf<sf::Event::MouseWheelScrolled>()) {
+        put_type(EventType::MouseWheelScrolled);
+        out.push_back(static_cast<std::uint8_t>(wheel->wheel));
+        write_varint(out, std::bit_cast<std::uint32_t>(wheel->delta));
+        write_position(out, wheel->position);
+    } else if (auto button = event.getIf<sf::Event::MouseButtonPressed>()) {
+        put_type(EventType::MouseButtonPressed);
+        out.push_back(static_cast<std::uint8_t>(button->button));
+        write_position(out, button->position);
+    } else if (auto button = event.getIf<sf::Event::MouseButtonReleased>()) {
+        put_type(EventType::MouseButtonReleased);
+        out.push_back(static_cast<std::uint8_t>(button->button));
+        write_position(out, button->position);
+    } else if (auto moved = event.getIf<sf::Event::MouseMoved>()) {
+        put_type(EventType::MouseMoved);
+        write_position(out, moved->position);
+    } else if (event.is<sf::Event::MouseEntered>()) {
+        put_type(EventType::MouseEntered);
+    } else if (event.is<sf::Event::MouseLeft>()) {
+        put_type(EventType::MouseLeft);
+    }
+}
+
+bool is_recordable(const sf::Event& event) {
+    // 手柄、触摸、传感器等事件当前不影响游戏逻辑，不录制
+    return event.is<sf::Event::Closed>() || event.is<sf::Event::Resized>()
+        || event.is<sf::Event::FocusLost>() || event.is<sf::Event::FocusGained>()
+        || event.is<sf::Event::TextEntered>()
+        || event.is<sf::Event::KeyPressed>() || event.is<sf::Event::KeyReleased>()
+        || event.is<sf::Event::MouseWheelScrolled>()
+        || event.is<sf::Event::MouseButtonPressed>() || event.is<sf::Event::MouseButtonReleased>()
+        || event.is<sf::Event::MouseMoved>()
+        || event.is<sf::Event::MouseEntered>() || event.is<sf::Event::MouseLeft>();
+}
+
+// --- 解码 ---
+
+/// @brief 简单的字节读取器，越界时进入失败状态
+class Reader {
+public:
+    Reader(const std::vector<std::uint8_t>& data, std::size_t& cursor) : data_{data}, cursor_{cursor} {}
+
+    bool ok() const { return ok_; }
+
+    std::uint8_t byte() {
+        if (cursor_ >= data_.size()) { ok_ = false; return 0; }
+        return data_[cursor_++];
+    }
+
+    std::uint64_t varint() {
+        std::uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            const std::uint8_t b = byte();
+            if (!ok_) return 0;
+            value |= static_cast<std::uint64_t>(b & 0x7F) << shift;
+            if ((b & 0x80) == 0) return value;
+        }
+        ok_ = false;
+        return 0;
+    }
+
+    std::int64_t signed_varint() {
+        const std::uint64_t raw = varint();
+        return static_cast<std::int64_t>(raw >> 1) ^ -static_cast<std::int64_t>(raw & 1);
+    }
+
+    sf::Vector2i position() {
+        const auto x = static_cast<int>(signed_varint());
+        const auto y = static_cast<int>(signed_varint());
+        return {x, y};
+    }
+
+    template <typename KeyEvent>
+    KeyEvent key() {
+        KeyEvent key{};
+        key.code = static_cast<sf::Keyboard::Key>(signed_varint());
+        key.scancode = static_cast<sf::Keyboard::Scancode>(signed_varint());
+        const std::uint8_t modifiers = byte();
+        key.alt = modifiers & 1;
+        key.control = modifiers & 2;
+        key.shift = modifiers & 4;
+        key.system = modifiers & 8;
+        return key;
+    }
+
+private:
+    const std::vector<std::uint8_t>& data_;
+    std::size_t& cursor_;
+    bool ok_ = true;
+};
+
+std::optional<sf::Event> read_event(Reader& reader) {
+    switch (static_cast<EventType>(reader.byte())) {
+        case EventType::Closed: return sf::Event::Closed{};
+        case EventType::Resized: {
+            sf::Event::Resized resized{};
+            resized.size.x = static_cast<unsigned int>(reader.varint());
+            resized.size.y = static_cast<unsigned int>(reader.varint());
+            return resized;
+        }
+        case EventType::FocusLost: return sf::Event::FocusLost{};
+        case EventType::FocusGained: return sf::Event::FocusGained{};
+        case EventType::TextEntered: {
+            sf::Event::TextEntered text{};
+            text.unicode = static_cast<char32_t>(reader.varint());
+            return text;
+        }
+        case EventType::KeyPressed: return reader.key<sf::Event::KeyPressed>();
+        case EventType::KeyReleased: return reader.key<sf::Event::KeyReleased>();
+        case EventType::MouseWheelScrolled: {
+            sf::Event::MouseWheelScrolled wheel{};
+            wheel.wheel = static_cast<sf::Mouse::Wheel>(reader.byte());
+            wheel.delta = std::bit_cast<float>(static_cast<std::uint32_t>(reader.varint()));
+            wheel.position = reader.position();
+            return wheel;
+        }
+        case EventType::MouseButtonPressed: {
+            sf::Event::MouseButtonPressed button{};
+            button.button = static_cast<sf::Mouse::Button>(reader.byte());
+            button.position = reader.position();
+            return button;
+        }
+        case EventType::MouseButtonReleased: {
+            sf::Event::MouseButtonReleased button{};
+            button.button = static_cast<sf::Mouse::Button>(reader.byte());
+            button.position = reader.position();
+            return button;
+        }
+        case EventType::MouseMoved: {
+            sf::Event::MouseMoved moved{};
+            moved.position = reader.position();
+            return moved;
+        }
+        case EventType::MouseEntered: return sf::Event::MouseEntered{};
+        case EventType::MouseLeft: return sf::Event::MouseLeft{};
+    }
+    return std::nullopt;
+}
+} // namespace
+
+// --- InputRecorder ---
+
+InputRecorder::InputRecorder(std::int64_t fixed_step_us)
+    : fixed_step_us_{fixed_step_us} {
+    data_.reserve(64 * 1024);
+}
+
+void InputRecorder::begin_frame(std::uint64_t tick) {
+    if (has_frame_) flush_frame();
+    has_frame_ = true;
+    current_tick_ = tick;
+}
+
+void InputRecorder::record(const sf::Event& event) {
+    if (is_recordable(event)) pending_events_.push_back(event);
+}
+
+void InputRecorder::flush_frame() {
+    write_varint(data_, current_tick_ - last_tick_);
+    write_varint(data_, pending_events_.size());
+    for (const auto& event : pending_events_) {
+        write_event(data_, event);
+    }
+    last_tick_ = current_tick_;
+    pending_events_.clear();
+    ++frame_count_;
+}
+
+bool InputRecorder::save_to_file(std::string_view filepath, std::uint64_t final_tick) {
+    if (has_frame_) {
+        flush_frame();
+        has_frame_ = false;
+    }
+
+    std::vector<std::uint8_t> header(std::begin(replay_format::MAGIC), std::end(replay_format::MAGIC));
+    write_varint(header, replay_format::VERSION);
+    write_signed(header, fixed_step_us_);
+    write_varint(header, final_tick);
+
+    std::ofstream file(std::string(filepath), std::ios::binary);
+    if (!file.is_open()) {
+        spdlog::error("无法写入输入录制文件 '{}'", filepath);
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+    file.write(reinterpret_cast<const char*>(data_.data()), static_cast<std::streamsize>(data_.size()));
+    if (!file) {
+        spdlog::error("写入输入录制文件 '{}' 失败", filepath);
+        return false;
+    }
+    spdlog::info("输入录制已保存到 '{}'：{} 帧，{} 次更新，{} 字节", filepath, frame_count_, final_tick, header.size() + data_.size());
+    return true;
+}
+
+// --- InputPlayer ---
+
+bool InputPlayer::load_from_file(std::string_view filepath) {
+    std::ifstream file(std::string(filepath), std::ios::binary);
+    if (!file.is_open()) {
+        spdlog::error("无法打开输入录制文件 '{}'", filepath);
+        return false;
+    }
+    data_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    cursor_ = 0;
+    tick_ = 0;
+    frame_steps_ = 0;
+
+    if (!read_header()) {
+        spdlog::error("输入录制文件 '{}' 格式无效", filepath);
+        finished_ = true;
+        return false;
+    }
+    finished_ = false;
+    spdlog::info("已加载输入录制 '{}'：{} 次更新，固定步长 {} us", filepath, final_tick_, fixed_step_us_);
+    return true;
+}
+
+bool InputPlayer::read_header() {
+    if (data_.size() < sizeof(replay_format::MAGIC)
+        || std::memcmp(data_.data(), replay_format::MAGIC, sizeof(replay_format::MAGIC)) != 0) {
+        return false;
+    }
+    cursor_ = sizeof(replay_format::MAGIC);
+
+    Reader reader(data_, cursor_);
+    const auto version = reader.varint();
+    if (version != replay_format::VERSION) {
+        spdlog::error("不支持的输入录制版本：{}", version);
+        return false;
+    }
+    fixed_step_us_ = reader.signed_varint();
+    final_tick_ = reader.varint();
+    return reader.ok();
+}
+
+bool InputPlayer::next_frame(std::vector<sf::Event>& events) {
+    events.clear();
+    frame_steps_ = 0;
+    if (finished_ || cursor_ >= data_.size()) {
+        finished_ = true;
+        return false;
+    }
+
+    Reader reader(data_, cursor_);
+    tick_ += reader.varint();
+    const auto count = reader.varint();
+    for (std::uint64_t i = 0; i < count && reader.ok(); ++i) {
+        if (auto event = read_event(reader); event) {
+            events.push_back(*event);
+        } else {
+            spdlog::error("输入录制数据损坏（未知事件类型），停止回放");
+            finished_ = true;
+            return false;
+        }
+    }
+    if (!reader.ok()) {
+        spdlog::error("输入录制数据被截断，停止回放");
+        finished_ = true;
+        return false;
+    }
+
+    // 本帧的更新次数 = 下一帧的 tick 差值（最后一帧则使用文件头中的结束 tick）
+    if (cursor_ < data_.size()) {
+        std::size_t peek = cursor_;
+        Reader peek_reader(data_, peek);
+        frame_steps_ = peek_reader.varint();
+    } else {
+        frame_steps_ = final_tick_ >= tick_ ? final_tick_ - tick_ : 0;
+    }
+    return true;
+}
+} // namespace engine::input
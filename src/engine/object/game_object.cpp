@@ -1,28 +1,165 @@
 #include "engine/object/game_object.hpp"
+#include "engine/core/context.hpp"
+#include "engine/scene/scene.hpp"
+#include "engine/utils/profiler.hpp"
 #include <SFML/System/Time.hpp>
-#include <ranges>
+#include <algorithm>
+#include <new>
 
 namespace engine::object {
-GameObject::GameObject(std::string_view name, std::string_view tag)
-    : name_{name}
-    , tag_{tag} {
+namespace {
+/// @brief 对象前的分配头，记录内存来自哪个内存池（为空表示堆）
+struct AllocationHeader {
+    engine::utils::Arena* arena;
+};
+constexpr std::size_t HEADER_SIZE = alignof(std::max_align_t);     // 保证对象本身仍按 max_align_t 对齐
+static_assert(sizeof(AllocationHeader) <= HEADER_SIZE);
+
+void* write_header(void* raw, engine::utils::Arena* arena) {
+    ::new (raw) AllocationHeader{arena};
+    return static_cast<std::byte*>(raw) + HEADER_SIZE;
+}
+} // namespace
+
+void* GameObject::operator new(std::size_t size) {
+    return write_header(::operator new(size + HEADER_SIZE), nullptr);
+}
+
+void* GameObject::operator new(std::size_t size, engine::utils::Arena& arena) {
+    return write_header(arena.allocate(size + HEADER_SIZE), &arena);
+}
+
+void GameObject::operator delete(void* ptr, std::size_t size) noexcept {
+    if (!ptr) return;
+    auto* raw = static_cast<std::byte*>(ptr) - HEADER_SIZE;
+    if (auto* arena = reinterpret_cast<AllocationHeader*>(raw)->arena; arena) {
+        arena->deallocate(raw, size + HEADER_SIZE);
+    } else {
+        ::operator delete(raw);
+    }
+}
+
+void GameObject::operator delete(void* ptr, engine::utils::Arena& arena) noexcept {
+    arena.deallocate(static_cast<std::byte*>(ptr) - HEADER_SIZE, sizeof(GameObject) + HEADER_SIZE);
+}
+
+GameObject::GameObject(ObjectRegistry& registry, std::string_view name, std::string_view tag)
+    : registry_{registry}
+    , entity_{registry.create()}
+    , name_{name}
+    , tag_{tag}
+    , name_id_{to_id(name)}
+    , tag_id_{to_id(tag)} {
+    registry_.emplace<ObjectLink>(entity_, this);
+}
+
+GameObject::~GameObject() {
+    if (registry_.valid(entity_)) {
+        registry_.destroy(entity_);
+    }
+}
+
+void GameObject::set_name(std::string_view name) {
+    const auto old_id = name_id_;
+    name_ = name;
+    name_id_ = to_id(name);
+    if (scene_obs_ && old_id != name_id_) scene_obs_->on_name_changed(this, old_id);
+}
+
+void GameObject::set_tag(std::string_view tag) {
+    const auto old_id = tag_id_;
+    tag_ = tag;
+    tag_id_ = to_id(tag);
+    if (scene_obs_ && old_id != tag_id_) scene_obs_->on_tag_changed(this, old_id);
+}
+
+void GameObject::set_need_remove(bool need_remove) {
+    if (need_remove_ == need_remove) return;
+    need_remove_ = need_remove;
+    if (need_remove) registry_.emplace_or_replace<PendingRemoval>(entity_);
+    else registry_.remove<PendingRemoval>(entity_);
+}
+
+void GameObject::reset_components() {
+    for (std::uint8_t i = 0; i < component_count_; ++i) {
+        components_[component_order_[i]]->reset();
+    }
 }
 
 void GameObject::handle_input(engine::core::Context& context) {
-    for (auto& component : components_ | std::views::values) {
-        component->handle_input(context);
+    auto& profiler = context.get_profiler();
+    if (!profiler.is_enabled()) {
+        for (std::uint8_t i = 0; i < component_count_; ++i) {
+            if (auto* component = components_[component_order_[i]]; component->is_ticking(engine::utils::ComponentPhase::HandleInput)) {
+                component->handle_input(context);
+            }
+        }
+        return;
+    }
+    // 分析器开启时按组件类型分别计时
+    for (std::uint8_t i = 0; i < component_count_; ++i) {
+        const auto type_id = component_order_[i];
+        if (!components_[type_id]->is_ticking(engine::utils::ComponentPhase::HandleInput)) continue;
+        engine::utils::ScopedZone zone{profiler, engine::component::get_component_zone(type_id, engine::utils::ComponentPhase::HandleInput)};
+        components_[type_id]->handle_input(context);
     }
 }
 
 void GameObject::update(sf::Time delta, engine::core::Context& context) {
-    for (auto& component : components_ | std::views::values) {
-        component->update(delta, context);
+    auto& profiler = context.get_profiler();
+    if (!profiler.is_enabled()) {
+        for (std::uint8_t i = 0; i < component_count_; ++i) {
+            if (auto* component = components_[component_order_[i]]; component->is_ticking(engine::utils::ComponentPhase::Update)) {
+                component->update(delta, context);
+            }
+        }
+        return;
+    }
+    for (std::uint8_t i = 0; i < component_count_; ++i) {
+        const auto type_id = component_order_[i];
+        if (!components_[type_id]->is_ticking(engine::utils::ComponentPhase::Update)) continue;
+        engine::utils::ScopedZone zone{profiler, engine::component::get_component_zone(type_id, engine::utils::ComponentPhase::Update)};
+        components_[type_id]->update(delta, context);
     }
 }
 
 void GameObject::render(engine::core::Context& context) {
-    for (auto& component : components_ | std::views::values) {
-        component->render(context);
+    auto& profiler = context.get_profiler();
+    if (!profiler.is_enabled()) {
+        for (std::uint8_t i = 0; i < component_count_; ++i) {
+            if (auto* component = components_[component_order_[i]]; component->is_ticking(engine::utils::ComponentPhase::Render)) {
+                component->render(context);
+            }
+        }
+        return;
+    }
+    for (std::uint8_t i = 0; i < component_count_; ++i) {
+        const auto type_id = component_order_[i];
+        if (!components_[type_id]->is_ticking(engine::utils::ComponentPhase::Render)) continue;
+        engine::utils::ScopedZone zone{profiler, engine::component::get_component_zone(type_id, engine::utils::ComponentPhase::Render)};
+        components_[type_id]->render(context);
+    }
+}
+
+void GameObject::on_component_added(engine::component::Component* component) {
+    if (scene_obs_) scene_obs_->sync_component_ticks(component);
+}
+
+void GameObject::on_component_removed(engine::component::Component* component) {
+    if (scene_obs_) scene_obs_->untrack_component(component);
+}
+
+void GameObject::on_component_tick_changed(engine::component::Component* component) {
+    // 组件构造函数中调用 set_tick_phases 时也会走到这里，add_component 随后还会再同步一次（同步是幂等的）
+    if (scene_obs_) scene_obs_->sync_component_ticks(component);
+}
+
+void GameObject::erase_from_order(engine::component::ComponentTypeId type_id) {
+    auto* begin = component_order_.data();
+    auto* end = begin + component_count_;
+    if (auto* it = std::find(begin, end, type_id); it != end) {
+        std::copy(it + 1, end, it);     // 保持其余组件的相对顺序
+        --component_count_;
     }
 }
-} // namespace engine::object
\ No newline at end of file
+} // namespace engine::object
@@ -0,0 +1,80 @@
+#include "engine/object/object_pool.hpp"
+#include "engine/object/game_object.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+namespace engine::object {
+ObjectPool::ObjectPool(std::string_view name, Factory factory, Reset reset)
+    : name_{name}
+    , factory_{std::move(factory)}
+    , reset_{std::move(reset)} {
+}
+
+ObjectPool::~ObjectPool() {
+    spdlog::debug("对象池 '{}' 销毁：命中 {} 次，未命中 {} 次，共创建 {} 个对象，使用峰值 {}",
+                  name_, stats_.hits, stats_.misses, stats_.created, stats_.peak_in_use);
+}
+
+std::unique_ptr<GameObject> ObjectPool::acquire() {
+    std::unique_ptr<GameObject> object;
+    if (!idle_.empty()) {
+        object = std::move(idle_.back());
+        idle_.pop_back();
+        ++stats_.hits;
+        // 回到刚创建时的状态：清除移除标记（同时移除 PendingRemoval），重置组件
+        // 实体保持不变，代数加一使上一次使用期间取得的句柄失效
+        ++object->registry_.get<ObjectLink>(object->entity_).generation;
+        object->set_need_remove(false);
+        object->reset_components();
+        if (reset_) reset_(*object);
+    } else {
+        object = create();
+        if (!object) return nullptr;
+        ++stats_.misses;
+    }
+    stats_.idle = idle_.size();
+    stats_.peak_in_use = std::max(stats_.peak_in_use, ++in_use_);
+    return object;
+}
+
+void ObjectPool::release(std::unique_ptr<GameObject> object) {
+    if (!object) return;
+    if (object->pool_obs_ != this) {
+        spdlog::warn("对象 '{}' 不属于对象池 '{}'，直接销毁", object->get_name(), name_);
+        return;
+    }
+    // 保持移除标记，闲置期间系统通过 PendingRemoval 略过它
+    object->set_need_remove(true);
+    idle_.push_back(std::move(object));
+    ++stats_.releases;
+    stats_.idle = idle_.size();
+    if (in_use_ > 0) --in_use_;
+}
+
+void ObjectPool::warm_up(std::size_t count) {
+    idle_.reserve(count);
+    while (idle_.size() < count) {
+        auto object = create();
+        if (!object) break;
+        object->set_need_remove(true);
+        idle_.push_back(std::move(object));
+    }
+    stats_.idle = idle_.size();
+}
+
+float ObjectPool::get_hit_rate() const {
+    const auto total = stats_.hits + stats_.misses;
+    return total > 0 ? static_cast<float>(stats_.hits) / static_cast<float>(total) : 1.f;
+}
+
+std::unique_ptr<GameObject> ObjectPool::create() {
+    auto object = factory_ ? factory_() : nullptr;
+    if (!object) {
+        spdlog::error("对象池 '{}' 的工厂没有返回对象", name_);
+        return nullptr;
+    }
+    object->pool_obs_ = this;
+    ++stats_.created;
+    return object;
+}
+} // namespace engine::object
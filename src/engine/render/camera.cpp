@@ -8,8 +8,7 @@
 
 namespace engine::render {
 Camera::Camera(sf::RenderWindow* window, std::optional<sf::FloatRect> limit_bounds)
-    : window_obs_{window}
-    , world_view_{window->getDefaultView()}
+    : world_view_{window->getDefaultView()}
     , ui_view_{window->getDefaultView()}
     , limit_bounds_{limit_bounds} {
     spdlog::trace("Camera 初始化成功");
@@ -17,16 +16,24 @@ Camera::Camera(sf::RenderWindow* window, std::optional<sf::FloatRect> limit_boun
     // ui_view_.zoom(0.5f);
     // world_view_.setCenter(world_view_.getSize() / 2.f);
     // ui_view_.setCenter(ui_view_.getSize() / 2.f);
-    
-    window_obs_->setView(world_view_);
+}
+
+Camera::Camera(sf::Vector2f view_size, std::optional<sf::FloatRect> limit_bounds)
+    : world_view_{sf::FloatRect({0.f, 0.f}, view_size)}
+    , ui_view_{sf::FloatRect({0.f, 0.f}, view_size)}
+    , limit_bounds_{limit_bounds} {
+    spdlog::trace("Camera 以无窗口模式初始化成功");
 }
 
 void Camera::update(sf::Time delta_time) {
     if (target_obs_ == nullptr) return;
     
+    // 与变换组件一样只在固定步长中前进，渲染时由 interpolate 在两次更新之间插值，
+    // 因此相机与目标精灵使用同一个 alpha，跟随时两者之间没有抖动
+    previous_follow_center_ = follow_center_;
     sf::Vector2f target_pos = target_obs_->get_position();
     sf::Vector2f desired_center = target_pos;   // 目标位置就是期望的视图中心
-    sf::Vector2f current_center = world_view_.getCenter();
+    sf::Vector2f current_center = follow_center_;
     
     // 计算当前位置与目标位置的距离
     sf::Vector2f diff = desired_center - current_center;
@@ -47,11 +54,28 @@ void Camera::update(sf::Time delta_time) {
     
     world_view_.setCenter(new_center);
     clamp_position();
+    follow_center_ = world_view_.getCenter();
+}
+
+void Camera::interpolate(float alpha) {
+    if (target_obs_ == nullptr) return;
+    // 两端都已限制在边界内，插值结果同样在边界内
+    world_view_.setCenter(previous_follow_center_ + (follow_center_ - previous_follow_center_) * alpha);
+}
+
+void Camera::set_target(engine::component::TransformComponent* target) {
+    target_obs_ = target;
+    snap_follow_center();
+}
+
+void Camera::snap_follow_center() {
+    follow_center_ = previous_follow_center_ = world_view_.getCenter();
 }
 
 void Camera::set_world_view_center(sf::Vector2f center) {
     world_view_.setCenter(center);
     clamp_position();
+    snap_follow_center();
 }
 
 void Camera::set_ui_view_center(sf::Vector2f center) {
@@ -62,12 +86,13 @@ void Camera::set_ui_view_center(sf::Vector2f center) {
 void Camera::move(const sf::Vector2f& offset) {
     world_view_.move(offset);
     clamp_position();
-    window_obs_->setView(world_view_);
+    snap_follow_center();
 }
 
 void Camera::set_limit_bounds(std::optional<sf::FloatRect> limit_bounds) {
     limit_bounds_ = limit_bounds;
     clamp_position();
+    snap_follow_center();
 }
 
 void Camera::clamp_position() {
@@ -101,8 +126,8 @@ void Camera::clamp_position() {
 }
 
 sf::Vector2f Camera::world_to_screen(const sf::Vector2f& world_pos) const {
-    // 将世界坐标减去相机左上角位置
-    return window_obs_->mapPixelToCoords(static_cast<sf::Vector2i>(world_pos));
+    // 将世界坐标减去相机左上角位置（只使用相机自己的视图，不访问窗口，可以在模拟线程调用）
+    return world_pos - (get_world_view_center() - get_world_view_size() / 2.f);
 }
 
 sf::Vector2f Camera::world_to_screen_with_parallax(const sf::Vector2f& world_pos, const sf::Vector2f& scroll_factor) const {
@@ -113,12 +138,12 @@ sf::Vector2f Camera::world_to_screen_with_parallax(const sf::Vector2f& world_pos
     // 2. 应用视差效果：世界坐标减去视差偏移
     sf::Vector2f parallax_adjusted_pos = world_pos - parallax_offset;
     
-    // 3. 转换为屏幕坐标（与第一个函数保持一致）
-    return window_obs_->mapPixelToCoords(static_cast<sf::Vector2i>(parallax_adjusted_pos));
+    // 3. 转换为屏幕坐标（与第一个函数保持一致，滚动因子为 1 时结果相同）
+    return parallax_adjusted_pos + get_world_view_size() / 2.f;
 }
 
 sf::Vector2f Camera::screen_to_world(const sf::Vector2f& screen_pos) const {
     // 将屏幕坐标加上相机左上角位置
-    return static_cast<sf::Vector2f>(window_obs_->mapCoordsToPixel(screen_pos));
+    return screen_pos + (get_world_view_center() - get_world_view_size() / 2.f);
 }
 } // namespace engine::render
\ No newline at end of file
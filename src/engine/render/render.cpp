@@ -1,6 +1,8 @@
 #include "engine/render/render.hpp"
 #include "engine/resource/resource_manager.hpp"
 #include "engine/render/camera.hpp"
+#include "engine/render/render_snapshot.hpp"
+#include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/Sprite.hpp>
@@ -12,10 +14,11 @@
 namespace engine::render {
 Renderer::Renderer(sf::RenderWindow* window, engine::resource::ResourceManager* resource_manager)
     : window_obs_{window}
-    , resourec_manager_obs_{resource_manager} {
+    , resourec_manager_obs_{resource_manager}
+    , immediate_{std::make_unique<RenderSnapshot>()} {
     spdlog::trace("构造 Renderer...");
     if (!window_obs_) {
-        throw std::runtime_error("Renderer 构造失败：提供的 window 指针为空");
+        spdlog::info("Renderer 未绑定窗口，以无头模式运行（忽略所有绘制）");
     }
     if (!resourec_manager_obs_) {
         throw std::runtime_error("ResourceManager 构造失败：提供的 ResourceManager 指针为空");
@@ -23,17 +26,86 @@ Renderer::Renderer(sf::RenderWindow* window, engine::resource::ResourceManager*
     spdlog::trace("Renderer 构造成功");
 }
 
+Renderer::~Renderer() = default;
+
 void Renderer::clear_frame() {
+    if (!window_obs_) return;
     window_obs_->clear(sf::Color::Black);
 }
 
 void Renderer::display_frame() {
+    if (!window_obs_) return;
+    flush();
     window_obs_->display();
 }
 
-void Renderer::draw_sprite(const Camera& camera, sf::Sprite& sprite) {
-    window_obs_->setView(camera.get_world_view());
-    window_obs_->draw(sprite);
+void Renderer::flush() {
+    if (recording_obs_ || immediate_->empty()) return;
+    submit(*immediate_);
+    immediate_->clear();
+    // 直接绘制模式下只有这一个快照，提交之后退役的纹理不再被引用
+    retired_textures_.clear();
+}
+
+void Renderer::begin_recording(RenderSnapshot& snapshot) {
+    flush();
+    snapshot.clear();
+    recording_obs_ = &snapshot;
+    for (auto& texture : retired_textures_) {
+        snapshot.retain(std::move(texture));
+    }
+    retired_textures_.clear();
+}
+
+void Renderer::retire_texture(std::unique_ptr<sf::RenderTexture> texture) {
+    if (!texture) return;
+    if (recording_obs_) {
+        recording_obs_->retain(std::move(texture));
+    } else {
+        retired_textures_.push_back(std::move(texture));
+    }
+}
+
+void Renderer::end_recording() {
+    recording_obs_ = nullptr;
+}
+
+void Renderer::submit(const RenderSnapshot& snapshot) {
+    if (!window_obs_) return;
+    const auto& views = snapshot.get_views();
+    std::size_t current_view = views.size();        // 无效值，保证第一条命令一定会设置视图
+
+    auto apply_view = [&](RenderSnapshot::ViewIndex index) {
+        if (index == current_view || index >= views.size()) return;
+        window_obs_->setView(views[index]);
+        current_view = index;
+    };
+
+    const auto& vertices = snapshot.get_vertices();
+    submit_stats_ = {snapshot.get_sprite_count(), snapshot.get_commands().size()};
+    for (const auto& command : snapshot.get_commands()) {
+        if (auto batch_cmd = std::get_if<RenderSnapshot::SpriteBatchCommand>(&command); batch_cmd) {
+            apply_view(batch_cmd->view);
+            sf::RenderStates states{batch_cmd->blend};
+            states.texture = batch_cmd->texture;
+            window_obs_->draw(vertices.data() + batch_cmd->first_vertex, batch_cmd->vertex_count, sf::PrimitiveType::Triangles, states);
+        } else if (auto text_cmd = std::get_if<RenderSnapshot::TextCommand>(&command); text_cmd) {
+            apply_view(text_cmd->view);
+            draw_text_now(text_cmd->text, *text_cmd->font, text_cmd->font_size, text_cmd->position, text_cmd->color);
+        } else if (auto rect_cmd = std::get_if<RenderSnapshot::RectCommand>(&command); rect_cmd) {
+            apply_view(rect_cmd->view);
+            sf::RectangleShape shape;
+            shape.setPosition(rect_cmd->rect.position);
+            shape.setSize(rect_cmd->rect.size);
+            shape.setFillColor(rect_cmd->color);
+            window_obs_->draw(shape);
+        }
+    }
+}
+
+void Renderer::draw_sprite(const Camera& camera, sf::Sprite& sprite, const sf::BlendMode& blend) {
+    if (!has_target()) return;
+    emit_sprite(camera.get_world_view(), sprite, blend);
 }
 
 void Renderer::draw_parallax(
@@ -43,6 +115,7 @@ void Renderer::draw_parallax(
     sf::Vector2<bool> repeat,
     const sf::Vector2f& scale
 ) {
+    if (!has_target()) return;
     sf::IntRect src = sprite.getTextureRect();
     if (src.size.x <= 0 || src.size.y <= 0) return;
 
@@ -71,11 +144,9 @@ void Renderer::draw_parallax(
     sf::Vector2f view_min = view_center - view_size / 2.f;
     sf::Vector2f view_max = view_center + view_size / 2.f;
 
-    window_obs_->setView(view);
-
     if (!repeat.x && !repeat.y) {
         sprite.setPosition(layer_world_pos);
-        window_obs_->draw(sprite);
+        emit_sprite(view, sprite);
         return;
     }
 
@@ -97,14 +168,14 @@ void Renderer::draw_parallax(
     for (float y = start_y; y < end_y; y += tile_size.y) {
         for (float x = start_x; x < end_x; x += tile_size.x) {
             sprite.setPosition({x, y});
-            window_obs_->draw(sprite);
+            emit_sprite(view, sprite);
         }
     }
 }
 
-void Renderer::draw_ui_sprite(const Camera& camera, sf::Sprite& sprite) {
-    window_obs_->setView(camera.get_ui_view());
-    window_obs_->draw(sprite);
+void Renderer::draw_ui_sprite(const Camera& camera, sf::Sprite& sprite, const sf::BlendMode& blend) {
+    if (!has_target()) return;
+    emit_sprite(camera.get_ui_view(), sprite, blend);
 }
 
 void Renderer::draw_text(const Camera& camera
@@ -113,7 +184,7 @@ void Renderer::draw_text(const Camera& camera
                        , unsigned int font_size
                        , sf::Vector2f position
                        , sf::Color font_color) {
-    window_obs_->setView(camera.get_world_view());
+    if (!has_target()) return;
 
     auto font = resourec_manager_obs_->get_font(font_id);
     if (!font) {
@@ -121,17 +192,7 @@ void Renderer::draw_text(const Camera& camera
         return;
     }
 
-    sf::String string(sf::String::fromUtf8(str.begin(), str.end()));
-    sf::Text text(*font, string, font_size);
-    text.setPosition(position);
-    text.setFillColor(font_color);
-
-    auto shadow = text;
-    shadow.setPosition(text.getPosition() + sf::Vector2f{2.f, 2.f});
-    shadow.setFillColor(sf::Color::Black);
-
-    window_obs_->draw(shadow);
-    window_obs_->draw(text);
+    emit_text(camera.get_world_view(), str, *font, font_size, position, font_color);
 }
 
 void Renderer::draw_ui_text(const Camera& camera
@@ -140,7 +201,7 @@ void Renderer::draw_ui_text(const Camera& camera
                           , unsigned int font_size
                           , sf::Vector2f position
                           , sf::Color font_color) {
-    window_obs_->setView(camera.get_ui_view());
+    if (!has_target()) return;
 
     auto font = resourec_manager_obs_->get_font(font_id);
     if (!font) {
@@ -148,8 +209,41 @@ void Renderer::draw_ui_text(const Camera& camera
         return;
     }
 
+    emit_text(camera.get_ui_view(), str, *font, font_size, position, font_color);
+}
+
+void Renderer::draw_ui_filled_rect(const Camera& camera, const sf::FloatRect& rect, sf::Color color) {
+    if (!has_target()) return;
+    emit_rect(camera.get_ui_view(), rect, color);
+}
+
+void Renderer::emit_sprite(const sf::View& view, const sf::Sprite& sprite, const sf::BlendMode& blend) {
+    auto& snapshot = target();
+    snapshot.push_sprite(sprite, snapshot.push_view(view), blend);
+}
+
+void Renderer::emit_text(const sf::View& view
+                       , std::string_view str
+                       , const sf::Font& font
+                       , unsigned int font_size
+                       , sf::Vector2f position
+                       , sf::Color font_color) {
+    auto& snapshot = target();
+    snapshot.push(RenderSnapshot::TextCommand{std::string(str), &font, font_size, position, font_color, snapshot.push_view(view)});
+}
+
+void Renderer::emit_rect(const sf::View& view, const sf::FloatRect& rect, sf::Color color) {
+    auto& snapshot = target();
+    snapshot.push(RenderSnapshot::RectCommand{rect, color, snapshot.push_view(view)});
+}
+
+void Renderer::draw_text_now(std::string_view str
+                           , const sf::Font& font
+                           , unsigned int font_size
+                           , sf::Vector2f position
+                           , sf::Color font_color) {
     sf::String string(sf::String::fromUtf8(str.begin(), str.end()));
-    sf::Text text(*font, string, font_size);
+    sf::Text text(font, string, font_size);
     text.setPosition(position);
     text.setFillColor(font_color);
 
@@ -160,13 +254,4 @@ void Renderer::draw_ui_text(const Camera& camera
     window_obs_->draw(shadow);
     window_obs_->draw(text);
 }
-
-void Renderer::draw_ui_filled_rect(const Camera& camera, const sf::FloatRect& rect, sf::Color color) {
-    window_obs_->setView(camera.get_ui_view());
-    sf::RectangleShape shape;
-    shape.setPosition({rect.position.x, rect.position.y});
-    shape.setSize({rect.size.x, rect.size.y});
-    shape.setFillColor(color);
-    window_obs_->draw(shape);
-}
-} // namespace engine::render
\ No newline at end of file
+} // namespace engine::render
@@ -0,0 +1,75 @@
+#include "engine/render/render_queue.hpp"
+#include "engine/render/render.hpp"
+#include <SFML/Graphics/Sprite.hpp>
+#include <array>
+#include <bit>
+
+namespace engine::render {
+namespace {
+constexpr std::uint32_t TEXTURE_ID_MASK = (1u << 24) - 1;
+constexpr std::size_t RADIX_BITS = 8;
+constexpr std::size_t RADIX_BUCKETS = std::size_t{1} << RADIX_BITS;
+constexpr std::size_t RADIX_PASSES = 64 / RADIX_BITS;
+
+/// @brief 把浮点数映射为保序的无符号整数（负数取反，正数置最高位）
+std::uint32_t ordered_bits(float value) {
+    if (value == 0.f) value = 0.f;     // -0 与 +0 视为相同
+    const auto bits = std::bit_cast<std::uint32_t>(value);
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+} // namespace
+
+std::uint64_t RenderQueue::make_key(RenderLayer layer, float sort_y, std::uint32_t texture_id) {
+    return (static_cast<std::uint64_t>(layer) << 56)
+         | (static_cast<std::uint64_t>(ordered_bits(sort_y)) << 24)
+         | (texture_id & TEXTURE_ID_MASK);
+}
+
+std::uint32_t RenderQueue::get_texture_id(const sf::Texture* texture) {
+    return texture_ids_.try_emplace(texture, static_cast<std::uint32_t>(texture_ids_.size())).first->second;
+}
+
+void RenderQueue::push(RenderLayer layer, float sort_y, sf::Sprite& sprite) {
+    items_.push_back({make_key(layer, sort_y, get_texture_id(&sprite.getTexture())), &sprite});
+}
+
+void RenderQueue::sort() {
+    const std::size_t count = items_.size();
+    if (count < 2) return;
+
+    // 一次遍历统计所有字节的直方图
+    std::array<std::array<std::size_t, RADIX_BUCKETS>, RADIX_PASSES> histograms{};
+    for (const Item& item : items_) {
+        for (std::size_t pass = 0; pass < RADIX_PASSES; ++pass) {
+            ++histograms[pass][(item.key >> (pass * RADIX_BITS)) & (RADIX_BUCKETS - 1)];
+        }
+    }
+
+    scratch_.resize(count);
+    for (std::size_t pass = 0; pass < RADIX_PASSES; ++pass) {
+        auto& histogram = histograms[pass];
+        const std::size_t shift = pass * RADIX_BITS;
+        // 所有键在这个字节上相同（例如层、纹理编号的高位），这一趟不会改变顺序
+        if (histogram[(items_.front().key >> shift) & (RADIX_BUCKETS - 1)] == count) continue;
+
+        std::size_t offset = 0;
+        for (auto& bucket : histogram) {
+            const std::size_t bucket_count = bucket;
+            bucket = offset;
+            offset += bucket_count;
+        }
+        for (const Item& item : items_) {
+            scratch_[histogram[(item.key >> shift) & (RADIX_BUCKETS - 1)]++] = item;
+        }
+        items_.swap(scratch_);
+    }
+}
+
+void RenderQueue::submit(Renderer& renderer, const Camera& camera) {
+    sort();
+    for (const Item& item : items_) {
+        renderer.draw_sprite(camera, *item.sprite);
+    }
+    clear();
+}
+} // namespace engine::render
@@ -0,0 +1,62 @@
+#include "engine/render/render_snapshot.hpp"
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <cmath>
+
+namespace engine::render {
+namespace {
+bool same_view(const sf::View& a, const sf::View& b) {
+    return a.getCenter() == b.getCenter()
+        && a.getSize() == b.getSize()
+        && a.getRotation() == b.getRotation()
+        && a.getViewport() == b.getViewport();
+}
+} // namespace
+
+RenderSnapshot::RenderSnapshot() = default;
+RenderSnapshot::~RenderSnapshot() = default;
+RenderSnapshot::RenderSnapshot(RenderSnapshot&&) = default;
+RenderSnapshot& RenderSnapshot::operator=(RenderSnapshot&&) = default;
+
+void RenderSnapshot::clear() {
+    views_.clear();
+    commands_.clear();
+    vertices_.clear();
+    retired_textures_.clear();
+}
+
+void RenderSnapshot::retain(std::unique_ptr<sf::RenderTexture> texture) {
+    if (texture) retired_textures_.push_back(std::move(texture));
+}
+
+RenderSnapshot::ViewIndex RenderSnapshot::push_view(const sf::View& view) {
+    // 一帧通常只有世界视图和 UI 视图交替出现，线性查找即可
+    for (std::size_t i = 0; i < views_.size(); ++i) {
+        if (same_view(views_[i], view)) return static_cast<ViewIndex>(i);
+    }
+    views_.push_back(view);
+    return static_cast<ViewIndex>(views_.size() - 1);
+}
+
+void RenderSnapshot::push_sprite(const sf::Sprite& sprite, ViewIndex view, const sf::BlendMode& blend) {
+    const sf::Texture* texture = &sprite.getTexture();
+    auto* batch = commands_.empty() ? nullptr : std::get_if<SpriteBatchCommand>(&commands_.back());
+    if (!batch || batch->texture != texture || batch->view != view || !(batch->blend == blend)) {
+        commands_.push_back(SpriteBatchCommand{texture, blend, static_cast<std::uint32_t>(vertices_.size()), 0, view});
+        batch = &std::get<SpriteBatchCommand>(commands_.back());
+    }
+
+    // 与 sf::Sprite 相同的局部顶点：纹理矩形尺寸为负表示翻转，局部尺寸取绝对值
+    const sf::FloatRect rect{sprite.getTextureRect()};
+    const sf::Vector2f size{std::abs(rect.size.x), std::abs(rect.size.y)};
+    const sf::Transform& transform = sprite.getTransform();
+    const sf::Color color = sprite.getColor();
+    const sf::Vertex top_left{transform.transformPoint({0.f, 0.f}), color, rect.position};
+    const sf::Vertex bottom_left{transform.transformPoint({0.f, size.y}), color, {rect.position.x, rect.position.y + rect.size.y}};
+    const sf::Vertex top_right{transform.transformPoint({size.x, 0.f}), color, {rect.position.x + rect.size.x, rect.position.y}};
+    const sf::Vertex bottom_right{transform.transformPoint(size), color, rect.position + rect.size};
+    vertices_.insert(vertices_.end(), {top_left, bottom_left, top_right, top_right, bottom_left, bottom_right});
+    batch->vertex_count += VERTICES_PER_SPRITE;
+}
+} // namespace engine::render
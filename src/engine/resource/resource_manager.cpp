@@ -1,8 +1,13 @@
 #include "engine/resource/resource_manager.hpp"
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <filesystem>
 #include <stdexcept>
 
 namespace engine::resource {
+ResourceManager::ResourceManager() = default;
+ResourceManager::~ResourceManager() = default;
+
 // ---------------- Texture ----------------
 sf::Texture* ResourceManager::load_texture(std::string_view file) {
     auto key = std::string(file);
@@ -31,6 +36,39 @@ void ResourceManager::unload_texture(std::string_view file) {
 
 void ResourceManager::clear_textures() {
     textures_.clear();
+    texture_atlas_.reset();
+}
+
+// ---------------- Texture atlas ----------------
+std::size_t ResourceManager::build_texture_atlas(const std::vector<std::string>& sources, unsigned int page_size) {
+    std::vector<std::string> files;
+    for (const auto& source : sources) {
+        std::error_code error;
+        if (!std::filesystem::is_directory(source, error)) {
+            files.push_back(source);
+            continue;
+        }
+        std::vector<std::string> directory_files;
+        for (const auto& entry : std::filesystem::directory_iterator(source, error)) {
+            if (entry.is_regular_file() && entry.path().extension() == ".png") {
+                directory_files.push_back(entry.path().generic_string());
+            }
+        }
+        std::ranges::sort(directory_files);
+        files.insert(files.end(), directory_files.begin(), directory_files.end());
+    }
+
+    if (!texture_atlas_) texture_atlas_ = std::make_unique<TextureAtlas>(page_size);
+    return texture_atlas_->build(files);
+}
+
+TextureRegion ResourceManager::load_texture_region(std::string_view file) {
+    if (texture_atlas_) {
+        if (const auto* region = texture_atlas_->find(file); region) return *region;
+    }
+    const sf::Texture* texture = load_texture(file);
+    if (!texture) return {};
+    return {texture, sf::IntRect({0, 0}, sf::Vector2i(texture->getSize()))};
 }
 
 // ---------------- SoundBuffer ----------------
@@ -0,0 +1,129 @@
+#include "engine/resource/texture_atlas.hpp"
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <utility>
+
+// ImGui 的 imgui_draw.cpp 以 STBRP_STATIC 编译了自己的一份实现，这里同样以 static 方式实现一份
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wimplicit-fallthrough"
+#endif
+#define STBRP_STATIC
+#define STB_RECT_PACK_IMPLEMENTATION
+#include <imstb_rectpack.h>
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+namespace engine::resource {
+namespace {
+/// @brief 等待打包的图片
+struct PendingImage {
+    const std::string* file;
+    sf::Image image;
+};
+} // namespace
+
+TextureAtlas::TextureAtlas(unsigned int page_size)
+    : page_size_{std::min(page_size, sf::Texture::getMaximumSize())} {
+    if (page_size_ < page_size) {
+        spdlog::warn("TextureAtlas: 页边长 {} 超过显卡支持的最大纹理尺寸，改为 {}", page_size, page_size_);
+    }
+}
+
+TextureAtlas::~TextureAtlas() = default;
+
+std::size_t TextureAtlas::build(const std::vector<std::string>& files) {
+    std::vector<PendingImage> pending;
+    pending.reserve(files.size());
+    for (const auto& file : files) {
+        if (regions_.contains(file)) continue;
+        sf::Image image;
+        if (!image.loadFromFile(file)) {
+            spdlog::error("TextureAtlas: 无法加载图片 '{}'", file);
+            continue;
+        }
+        const sf::Vector2u size = image.getSize();
+        if (size.x + PADDING > page_size_ || size.y + PADDING > page_size_) {
+            spdlog::debug("TextureAtlas: 图片 '{}' ({}x{}) 超过页尺寸，不打包", file, size.x, size.y);
+            continue;
+        }
+        pending.push_back({&file, std::move(image)});
+    }
+
+    std::size_t packed_count = 0;
+    std::vector<stbrp_node> nodes(page_size_);
+    while (!pending.empty()) {
+        // 每个矩形的宽高都加上间隔；id 是在 pending 中的下标
+        std::vector<stbrp_rect> rects(pending.size());
+        for (std::size_t i = 0; i < pending.size(); ++i) {
+            const sf::Vector2u size = pending[i].image.getSize();
+            rects[i] = {static_cast<int>(i), static_cast<stbrp_coord>(size.x + PADDING), static_cast<stbrp_coord>(size.y + PADDING), 0, 0, 0};
+        }
+        stbrp_context packer;
+        stbrp_init_target(&packer, static_cast<int>(page_size_), static_cast<int>(page_size_), nodes.data(), static_cast<int>(nodes.size()));
+        stbrp_setup_heuristic(&packer, STBRP_HEURISTIC_Skyline_BF_sortHeight);
+        stbrp_pack_rects(&packer, rects.data(), static_cast<int>(rects.size()));
+
+        // 页只保留实际用到的范围
+        sf::Vector2u used{0u, 0u};
+        for (const auto& rect : rects) {
+            if (!rect.was_packed) continue;
+            used.x = std::max(used.x, static_cast<unsigned int>(rect.x + rect.w));
+            used.y = std::max(used.y, static_cast<unsigned int>(rect.y + rect.h));
+        }
+        if (used.x == 0) {
+            spdlog::error("TextureAtlas: 剩余 {} 张图片无法打包", pending.size());
+            break;
+        }
+
+        sf::Image page(used, sf::Color::Transparent);
+        std::vector<PendingImage> remaining;
+        std::vector<std::pair<const std::string*, sf::IntRect>> placed;
+        for (const auto& rect : rects) {
+            auto& entry = pending[static_cast<std::size_t>(rect.id)];
+            if (!rect.was_packed) {
+                remaining.push_back(std::move(entry));
+                continue;
+            }
+            // 图片放在矩形中间，四周各留 PADDING / 2 像素
+            const sf::Vector2u position{static_cast<unsigned int>(rect.x) + PADDING / 2, static_cast<unsigned int>(rect.y) + PADDING / 2};
+            if (!page.copy(entry.image, position)) {
+                spdlog::error("TextureAtlas: 复制图片 '{}' 到图集页失败", *entry.file);
+                continue;
+            }
+            placed.emplace_back(entry.file, sf::IntRect(sf::Vector2i(position), sf::Vector2i(entry.image.getSize())));
+        }
+        pending = std::move(remaining);
+
+        auto texture = std::make_unique<sf::Texture>();
+        if (!texture->loadFromImage(page)) {
+            spdlog::error("TextureAtlas: 创建 {}x{} 的图集页失败，其中的图片改为独立纹理", used.x, used.y);
+            continue;
+        }
+        for (const auto& [file, rect] : placed) {
+            regions_[*file] = {texture.get(), rect};
+        }
+        packed_count += placed.size();
+        spdlog::debug("TextureAtlas: 第 {} 页 {}x{}，{} 张图片", pages_.size(), used.x, used.y, placed.size());
+        pages_.push_back(std::move(texture));
+    }
+
+    spdlog::info("TextureAtlas: 打包 {} 张图片到 {} 页", packed_count, pages_.size());
+    return packed_count;
+}
+
+const TextureRegion* TextureAtlas::find(std::string_view file) const {
+    auto it = regions_.find(std::string(file));
+    return it != regions_.end() ? &it->second : nullptr;
+}
+
+void TextureAtlas::clear() {
+    regions_.clear();
+    pages_.clear();
+}
+
+} // namespace engine::resource
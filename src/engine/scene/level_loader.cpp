@@ -114,7 +114,7 @@
 //     /*  可用类似方法获取其它各种属性，这里我们暂时用不上 */
 
 //     // 创建游戏对象
-//     auto game_object = std::make_unique<engine::object::GameObject>(layer_name);
+//     auto game_object = scene.create_game_object(layer_name);
 //     // 依次添加Transform，Parallax组件
 //     game_object->add_component<engine::component::TransformComponent>(offset);
 //     game_object->add_component<engine::component::ParallaxComponent>(*context_.get_resource_manager().get_texture(texture_id), scroll_factor, repeat);
@@ -143,7 +143,7 @@
 //     // 获取图层名称
 //     std::string layer_name = layer_json.value("name", "Unnamed");
 //     // 创建游戏对象
-//     auto game_object = std::make_unique<engine::object::GameObject>(layer_name);
+//     auto game_object = scene.create_game_object(layer_name);
 //     // 添加Tilelayer组件
 //     game_object->add_component<engine::component::TileLayerComponent>(tile_size_, map_size_, std::move(tiles));
 //     // 添加到场景中
@@ -173,7 +173,7 @@
 //             } else {    // 没有这些标识则默认是矩形对象
 //                 // --- 创建游戏对象并添加TransfromComponent ---
 //                 std::string object_name = object.value("name", "Unnamed");
-//                 auto game_object = std::make_unique<engine::object::GameObject>(object_name);
+//                 auto game_object = scene.create_game_object(object_name);
 //                     // 获取Transform相关信息 （自定义形状的坐标针对左上角）
 //                 auto position = sf::Vector2f(object.value("x", 0.f), object.value("y", 0.f));
 //                 auto dst_size = sf::Vector2f(object.value("width", 0.f), object.value("height", 0.f));
@@ -215,7 +215,7 @@
 //             std::string object_name = object.value("name", "Unnamed");
 
 //             // 创建游戏对象并添加组件
-//             auto game_object = std::make_unique<engine::object::GameObject>(object_name);
+//             auto game_object = scene.create_game_object(object_name);
 //             game_object->add_component<engine::component::TransformComponent>(position, scale, rotation);
 //             game_object->add_component<engine::component::SpriteComponent>(std::move(tile_info.sprite));
 
@@ -1,35 +1,102 @@
 #include "engine/scene/scene.hpp"
 #include "engine/render/camera.hpp"
+#include "engine/render/render.hpp"
 #include "engine/core/context.hpp"
+#include "engine/core/time.hpp"
 #include "engine/object/game_object.hpp"
+#include "engine/object/object_pool.hpp"
+#include "engine/component/sprite_component.hpp"
+#include "engine/component/transform_component.hpp"
 #include "engine/core/game_state.hpp"
 #include "engine/scene/scene_manager.hpp"
+#include "engine/system/animation_system.hpp"
+#include "engine/system/health_system.hpp"
+#include "engine/system/spatial_index_system.hpp"
+#include "engine/system/sprite_sync_system.hpp"
 #include "engine/ui/ui_manager.hpp"
+#include "engine/utils/profiler.hpp"
 #include "entt/signal/dispatcher.hpp"
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
 
 namespace engine::scene {
+namespace {
+/**
+ * @brief 遍历一个阶段的活动组件列表
+ * @note 使用下标遍历：回调中新启用的组件追加到末尾并在本轮执行；回调中停用的组件只把位置置空（见 Scene::tick_phase），
+ *       其他组件不会移动，每个组件本轮恰好执行一次
+ */
+template <typename Fn>
+void tick_components(std::vector<engine::component::Component*>& list
+                   , engine::utils::Profiler& profiler
+                   , engine::utils::ComponentPhase phase
+                   , bool skip_removed
+                   , Fn&& fn) {
+    if (!profiler.is_enabled()) {
+        for (std::size_t i = 0; i < list.size(); ++i) {
+            auto* component = list[i];
+            if (!component || (skip_removed && component->get_owner()->is_need_remove())) continue;
+            fn(*component);
+        }
+        return;
+    }
+    // 分析器开启时按组件类型分别计时
+    for (std::size_t i = 0; i < list.size(); ++i) {
+        auto* component = list[i];
+        if (!component || (skip_removed && component->get_owner()->is_need_remove())) continue;
+        engine::utils::ScopedZone zone{profiler, engine::component::get_component_zone(component->get_type_id(), phase)};
+        fn(*component);
+    }
+}
+} // namespace
+
+template <typename Fn>
+void Scene::tick_phase(engine::utils::ComponentPhase phase, bool skip_removed, Fn&& fn) {
+    const auto index = static_cast<std::size_t>(phase);
+    ticking_phase_ = index;
+    tick_components(tick_lists_[index], context_.get_profiler(), phase, skip_removed, std::forward<Fn>(fn));
+    ticking_phase_ = NOT_TICKING_PHASE;
+    compact_tick_list(index);
+}
+
 Scene::Scene(std::string_view name, engine::core::Context& context)
     : scene_name_{name}
     , context_{context}
+    , registry_{engine::utils::ArenaAllocator<entt::entity>{arena_}}
     , ui_manager_{std::make_unique<ui::UIManager>(context_.get_game_state().get_logical_size())} {
+    registry_.on_construct<engine::object::PendingRemoval>().connect<&Scene::on_spatial_removal>(this);
+    registry_.on_destroy<engine::spatial::SpatialIndexed>().connect<&Scene::on_spatial_removal>(this);
+    registry_.on_destroy<engine::component::SpriteComponent>().connect<&Scene::on_spatial_removal>(this);
+    add_system(std::make_unique<engine::system::SpatialIndexSystem>(spatial_grid_), engine::system::SystemStage::Update);
+    add_system(std::make_unique<engine::system::AnimationSystem>(), engine::system::SystemStage::Update);
+    add_system(std::make_unique<engine::system::HealthSystem>(), engine::system::SystemStage::Update);
+    add_system(std::make_unique<engine::system::SpriteSyncSystem>(sprite_grid_), engine::system::SystemStage::PreRender);
     spdlog::trace("场景 ‘{}’ 初始化完成", scene_name_);
 }
 
-Scene::~Scene() = default;
+Scene::~Scene() {
+    // 先析构所有对象（组件随实体一起销毁），之后注册表与内存池按声明的逆序整体释放
+    pending_additions_.clear();
+    game_objects_.clear();
+    registry_.on_construct<engine::object::PendingRemoval>().disconnect<&Scene::on_spatial_removal>(this);
+    registry_.on_destroy<engine::spatial::SpatialIndexed>().disconnect<&Scene::on_spatial_removal>(this);
+    registry_.on_destroy<engine::component::SpriteComponent>().disconnect<&Scene::on_spatial_removal>(this);
+    const auto& stats = arena_.get_stats();
+    spdlog::debug("场景 '{}' 销毁，内存池峰值 {} KB（{} 个块，{} 次分配）",
+                  scene_name_, stats.high_water_bytes / 1024, stats.block_count, stats.allocation_count);
+}
 
 void Scene::update(sf::Time delta) {
-    // 更新所有游戏对象，先略过需要移除的对象
-    for (auto& obj : game_objects_) {
-        if (obj && !obj->is_need_remove()) {
-            obj->update(delta, context_);
-        } else {
-            if (!obj) spdlog::warn("尝试更新一个空的游戏对象指针。");
-            std::erase_if(game_objects_, [](const std::unique_ptr<engine::object::GameObject>& obj) {
-                return !obj || obj->is_need_remove();
-            });
-        }
-    }
+    store_previous_transforms();
+
+    // 只更新参与 update 阶段的组件，略过需要移除的对象（它们在本轮末尾统一移除，循环中不修改容器）
+    tick_phase(engine::utils::ComponentPhase::Update, true
+             , [&](engine::component::Component& component) { component.update(delta, context_); });
+
+    // 按组件类型批量更新（动画、生命值等）
+    run_systems(engine::system::SystemStage::Update, delta);
 
     // 只有游戏进行中，才需要更新物理引擎和相机
     if (context_.get_game_state().is_playing()){
@@ -38,35 +105,70 @@ void Scene::update(sf::Time delta) {
 
     // 更新UI管理器
     ui_manager_->update(delta, context_);
-    
+
+    remove_dead_game_objects();       // 移除被标记的游戏对象
     process_pending_additions();      // 处理待添加（延时添加）的游戏对象
 }
 
 void Scene::render() {
-    // 渲染所有游戏对象
-    for (const auto& obj : game_objects_) {
-        if (obj) obj->render(context_);
-    }
+    // 相机与精灵使用同一个 alpha 插值，先确定视图（剔除与视差都依赖它），再把精灵等同步到插值后的变换，最后按活动列表绘制
+    context_.get_camera().interpolate(context_.get_time().get_interpolation_alpha());
+    run_systems(engine::system::SystemStage::PreRender, sf::Time::Zero);
+
+    // 只渲染参与 render 阶段的组件
+    tick_phase(engine::utils::ComponentPhase::Render, false
+             , [&](engine::component::Component& component) { component.render(context_); });
+
+    // 精灵在活动列表（地图、背景）之后绘制，只绘制与视口相交的部分；
+    // 活动列表中加入渲染队列的内容（例如前景瓦片层）与精灵一起排序
+    render_visible_sprites();
 
     // 渲染UI管理器
     ui_manager_->render(context_);
+
+    // 把本场景累积的精灵批次提交给窗口（录制模式下由主线程统一提交快照）
+    context_.get_renderer().flush();
+}
+
+void Scene::render_visible_sprites() {
+    ENGINE_PROFILE_ZONE(context_.get_profiler(), "Scene::render_visible_sprites");
+    const auto& view = context_.get_camera().get_world_view();
+    const sf::FloatRect view_rect{view.getCenter() - view.getSize() * 0.5f, view.getSize()};
+    sprite_grid_.query_overlapping(view_rect, visible_sprites_);
+    // 网格的查询顺序取决于格子，先按实体排序，使同一深度的精灵在帧间保持稳定的前后关系（队列排序是稳定的）
+    std::ranges::sort(visible_sprites_, {}, [](const engine::object::GameObject* object) { return entt::to_integral(object->get_entity()); });
+    for (auto* object : visible_sprites_) {
+        object->get_component<engine::component::SpriteComponent>()->enqueue(render_queue_);
+    }
+    // 按（层、y、纹理）排序后绘制：y 大的在前，同一深度内同一纹理相邻，便于合并批次
+    render_queue_.submit(context_.get_renderer(), context_.get_camera());
+    render_stats_ = {visible_sprites_.size(), sprite_grid_.size() - visible_sprites_.size()};
 }
 
 void Scene::handle_input() {
     // 处理UI管理器输入
     if (ui_manager_->handle_input(context_)) return;   // 如果输入事件被UI处理则返回，不再处理游戏对象输入
 
-    // 遍历所有游戏对象，略过需要移除的对象
-    for (auto& obj : game_objects_) {
-        if (obj && !obj->is_need_remove()) {
-            obj->handle_input(context_);
-        }
-    }
+    // 只遍历参与 handle_input 阶段的组件，略过需要移除的对象
+    tick_phase(engine::utils::ComponentPhase::HandleInput, true
+             , [&](engine::component::Component& component) { component.handle_input(context_); });
 }
 
 void Scene::add_game_object(std::unique_ptr<engine::object::GameObject>&& game_object) {
-    if (game_object) game_objects_.push_back(std::move(game_object));
-    else spdlog::warn("尝试向场景 '{}' 添加空游戏对象。", scene_name_);
+    if (!game_object) {
+        spdlog::warn("尝试向场景 '{}' 添加空游戏对象。", scene_name_);
+        return;
+    }
+    if (&game_object->get_registry() != &registry_) {
+        spdlog::warn("游戏对象 '{}' 的组件不在场景 '{}' 的注册表中，场景系统将无法遍历它的组件。", game_object->get_name(), scene_name_);
+    }
+    game_object->scene_index_ = game_objects_.size();
+    index_game_object(game_object.get());
+    // 新对象从当前位置开始插值，避免从构造时的位置“飞”过来
+    if (auto* transform = game_object->get_component<engine::component::TransformComponent>(); transform) {
+        transform->store_previous_position();
+    }
+    game_objects_.push_back(std::move(game_object));
 }
 
 void Scene::safe_add_game_object(std::unique_ptr<engine::object::GameObject>&& game_object) {
@@ -80,15 +182,10 @@ void Scene::remove_game_object(engine::object::GameObject* game_object_ptr) {
         return;
     }
 
-    // erase-remove 移除法不可用，因为智能指针与裸指针无法比较
-    // 需要使用 std::remove_if 和 lambda 表达式自定义比较的方式
-    auto it = std::remove_if(game_objects_.begin(), game_objects_.end(),
-                             [game_object_ptr](const std::unique_ptr<engine::object::GameObject>& p) {
-                                 return p.get() == game_object_ptr;    // 比较裸指针是否相等（自定义比较方式）
-                             });
-
-    if (it != game_objects_.end()) {
-        game_objects_.erase(it, game_objects_.end());   // 删除从it到末尾的元素（最后一个元素）
+    // 对象记录了自己在容器中的下标，直接交换到末尾弹出
+    const std::size_t index = game_object_ptr->scene_index_;
+    if (index < game_objects_.size() && game_objects_[index].get() == game_object_ptr) {
+        swap_and_pop(index);
         spdlog::trace("从场景 '{}' 中移除游戏对象。", scene_name_);
     } else {
         spdlog::warn("游戏对象指针未找到在场景 '{}' 中。", scene_name_);
@@ -99,18 +196,68 @@ void Scene::safe_remove_game_object(engine::object::GameObject* game_object_ptr)
     game_object_ptr->set_need_remove(true);
 }
 
+void Scene::safe_remove_game_object(engine::object::ObjectHandle handle) {
+    if (auto* game_object = resolve(handle); game_object) {
+        game_object->set_need_remove(true);
+    }
+}
+
+bool Scene::is_alive(engine::object::ObjectHandle handle) const {
+    return resolve(handle) != nullptr;
+}
+
+engine::object::GameObject* Scene::resolve(engine::object::ObjectHandle handle) const {
+    // valid 会比较版本号，对象销毁后旧句柄即失效；对象池复用对象时实体不变，由代数区分
+    if (handle.is_null() || !registry_.valid(handle.get_entity())) return nullptr;
+    const auto* link = registry_.try_get<engine::object::ObjectLink>(handle.get_entity());
+    if (!link || !link->object || link->generation != handle.get_generation() || link->object->is_need_remove()) return nullptr;
+    return link->object;
+}
+
 const std::vector<std::unique_ptr<engine::object::GameObject>>& Scene::get_game_objects() const {
     return game_objects_;
 }
 
 engine::object::GameObject* Scene::find_game_object_by_name(std::string_view name) const {
-        // 找到第一个符合条件的游戏对象就返回
-    for (const auto& obj : game_objects_) {
-        if (obj && obj->get_name() == name) {
-            return obj.get();
-        }
-    }
-    return nullptr;
+    const auto* bucket = find_bucket(name_buckets_, engine::object::GameObject::to_id(name), name);
+    return bucket ? bucket->objects.front() : nullptr;
+}
+
+engine::object::GameObject* Scene::find_game_object_by_name(entt::id_type name_id) const {
+    const auto* bucket = find_unique_bucket(name_buckets_, name_id);
+    return bucket ? bucket->objects.front() : nullptr;
+}
+
+const std::vector<engine::object::GameObject*>& Scene::get_game_objects_by_tag(std::string_view tag) const {
+    static const std::vector<engine::object::GameObject*> empty;
+    const auto* bucket = find_bucket(tag_buckets_, engine::object::GameObject::to_id(tag), tag);
+    return bucket ? bucket->objects : empty;
+}
+
+const std::vector<engine::object::GameObject*>& Scene::get_game_objects_by_tag(entt::id_type tag_id) const {
+    static const std::vector<engine::object::GameObject*> empty;
+    const auto* bucket = find_unique_bucket(tag_buckets_, tag_id);
+    return bucket ? bucket->objects : empty;
+}
+
+void Scene::add_system(std::unique_ptr<engine::system::System> system, engine::system::SystemStage stage) {
+    if (system) spdlog::trace("场景 '{}' 添加系统 '{}'", scene_name_, system->get_name());
+    schedulers_[static_cast<std::size_t>(stage)].add(std::move(system));
+}
+
+void Scene::run_systems(engine::system::SystemStage stage, sf::Time delta) {
+    schedulers_[static_cast<std::size_t>(stage)].run(registry_, delta, context_);
+}
+
+void Scene::settle_interpolation() {
+    store_previous_transforms();
+}
+
+void Scene::store_previous_transforms() {
+    // 直接遍历变换组件池，不需要经过游戏对象
+    registry_.view<engine::component::TransformComponent>().each([](engine::component::TransformComponent& transform) {
+        transform.store_previous_position();
+    });
 }
 
 void Scene::request_pop_scene() {
@@ -129,6 +276,204 @@ void Scene::quit() {
     context_.get_dispatcher().trigger<engine::utils::QuitEvent>();
 }
 
+void Scene::remove_dead_game_objects() {
+    // 被换到当前位置的对象也可能需要移除，所以移除后不前进
+    for (std::size_t i = 0; i < game_objects_.size();) {
+        if (game_objects_[i]->is_need_remove()) {
+            swap_and_pop(i);
+        } else {
+            ++i;
+        }
+    }
+}
+
+void Scene::swap_and_pop(std::size_t index) {
+    unindex_game_object(game_objects_[index].get());
+    auto removed = std::move(game_objects_[index]);
+    if (index + 1 != game_objects_.size()) {
+        game_objects_[index] = std::move(game_objects_.back());
+        game_objects_[index]->scene_index_ = index;
+    }
+    game_objects_.pop_back();
+    removed->scene_index_ = engine::object::GameObject::NOT_IN_SCENE;
+    // 池化对象归还给来源对象池，其他对象在此析构
+    if (auto* pool = removed->get_pool(); pool) {
+        pool->release(std::move(removed));
+    }
+}
+
+void Scene::on_spatial_removal(engine::object::ObjectRegistry&, entt::entity entity) {
+    spatial_grid_.remove(entity);
+    sprite_grid_.remove(entity);
+}
+
+void Scene::index_game_object(engine::object::GameObject* game_object) {
+    game_object->scene_obs_ = this;
+    add_to_name_bucket(game_object);
+    add_to_tag_bucket(game_object);
+    for (std::uint8_t i = 0; i < game_object->component_count_; ++i) {
+        sync_component_ticks(game_object->components_[game_object->component_order_[i]]);
+    }
+}
+
+void Scene::unindex_game_object(engine::object::GameObject* game_object) {
+    erase_name_entry(game_object, game_object->get_name_id());
+    remove_from_tag_bucket(game_object, game_object->get_tag_id());
+    for (std::uint8_t i = 0; i < game_object->component_count_; ++i) {
+        untrack_component(game_object->components_[game_object->component_order_[i]]);
+    }
+    game_object->scene_obs_ = nullptr;
+}
+
+void Scene::sync_component_ticks(engine::component::Component* component) {
+    using engine::component::Component;
+    for (std::size_t phase = 0; phase < Component::PHASE_COUNT; ++phase) {
+        auto& list = tick_lists_[phase];
+        auto& index = component->tick_index_[phase];
+        const bool wanted = component->is_ticking(static_cast<engine::utils::ComponentPhase>(phase));
+        if (wanted && index == Component::NOT_TICKING) {
+            index = static_cast<std::uint32_t>(list.size());
+            list.push_back(component);
+        } else if (!wanted && index != Component::NOT_TICKING) {
+            erase_tick_entry(phase, component);
+        }
+    }
+}
+
+void Scene::untrack_component(engine::component::Component* component) {
+    using engine::component::Component;
+    for (std::size_t phase = 0; phase < Component::PHASE_COUNT; ++phase) {
+        if (component->tick_index_[phase] == Component::NOT_TICKING) continue;
+        erase_tick_entry(phase, component);
+    }
+}
+
+void Scene::erase_tick_entry(std::size_t phase, engine::component::Component* component) {
+    using engine::component::Component;
+    auto& list = tick_lists_[phase];
+    auto& index = component->tick_index_[phase];
+    if (phase == ticking_phase_) {
+        // 正在遍历这个列表：只置空，遍历结束后统一压缩，避免其他组件被挪到已遍历的位置而跳过本轮
+        list[index] = nullptr;
+        tick_list_dirty_ = true;
+    } else if (phase == static_cast<std::size_t>(engine::utils::ComponentPhase::Render)) {
+        // Render 阶段的调用顺序就是绘制顺序：保序删除，后面的组件整体前移
+        list.erase(list.begin() + index);
+        for (std::size_t i = index; i < list.size(); ++i) {
+            list[i]->tick_index_[phase] = static_cast<std::uint32_t>(i);
+        }
+    } else {
+        // 其他阶段与顺序无关：swap-and-pop
+        list[index] = list.back();
+        list[index]->tick_index_[phase] = index;
+        list.pop_back();
+    }
+    index = Component::NOT_TICKING;
+}
+
+void Scene::compact_tick_list(std::size_t phase) {
+    if (!tick_list_dirty_) return;
+    tick_list_dirty_ = false;
+    auto& list = tick_lists_[phase];
+    std::erase(list, nullptr);
+    for (std::size_t i = 0; i < list.size(); ++i) {
+        list[i]->tick_index_[phase] = static_cast<std::uint32_t>(i);
+    }
+}
+
+void Scene::on_name_changed(engine::object::GameObject* game_object, entt::id_type old_name_id) {
+    erase_name_entry(game_object, old_name_id);
+    add_to_name_bucket(game_object);
+}
+
+void Scene::on_tag_changed(engine::object::GameObject* game_object, entt::id_type old_tag_id) {
+    remove_from_tag_bucket(game_object, old_tag_id);
+    add_to_tag_bucket(game_object);
+}
+
+void Scene::add_to_name_bucket(engine::object::GameObject* game_object) {
+    const auto name = game_object->get_name();
+    if (name.empty()) return;
+    bucket_for(name_buckets_, game_object->get_name_id(), name, "名称").objects.push_back(game_object);
+}
+
+void Scene::add_to_tag_bucket(engine::object::GameObject* game_object) {
+    const auto tag = game_object->get_tag();
+    if (tag.empty()) return;
+    auto& bucket = bucket_for(tag_buckets_, game_object->get_tag_id(), tag, "标签");
+    game_object->tag_index_ = bucket.objects.size();
+    bucket.objects.push_back(game_object);
+}
+
+void Scene::remove_from_tag_bucket(engine::object::GameObject* game_object, entt::id_type tag_id) {
+    if (game_object->tag_index_ == engine::object::GameObject::NOT_IN_SCENE) return;
+    if (auto it = tag_buckets_.find(tag_id); it != tag_buckets_.end()) {
+        // 旧标签字符串已不可用，按下标找到对象所在的分组
+        const std::size_t index = game_object->tag_index_;
+        for (auto& bucket : it->second) {
+            auto& objects = bucket.objects;
+            if (index < objects.size() && objects[index] == game_object) {
+                objects[index] = objects.back();
+                objects[index]->tag_index_ = index;
+                objects.pop_back();
+                break;
+            }
+        }
+    }
+    game_object->tag_index_ = engine::object::GameObject::NOT_IN_SCENE;
+}
+
+void Scene::erase_name_entry(engine::object::GameObject* game_object, entt::id_type name_id) {
+    auto it = name_buckets_.find(name_id);
+    if (it == name_buckets_.end()) return;
+    auto& chain = it->second;
+    for (auto bucket = chain.begin(); bucket != chain.end(); ++bucket) {
+        auto& objects = bucket->objects;
+        if (auto found = std::ranges::find(objects, game_object); found != objects.end()) {
+            *found = objects.back();
+            objects.pop_back();
+            if (objects.empty()) {
+                chain.erase(bucket);
+                if (chain.empty()) name_buckets_.erase(it);
+            }
+            return;
+        }
+    }
+}
+
+Scene::ObjectBucket& Scene::bucket_for(BucketMap& buckets, entt::id_type id, std::string_view key, std::string_view kind) {
+    auto& chain = buckets[id];
+    for (auto& bucket : chain) {
+        if (bucket.key == key) return bucket;
+    }
+    if (!chain.empty()) {
+        spdlog::warn("场景 '{}' 中{} '{}' 与 '{}' 的哈希值冲突：按字符串查找不受影响，按 id 查找将返回空。",
+                     scene_name_, kind, key, chain.front().key);
+    }
+    return chain.emplace_back(ObjectBucket{std::string(key), {}});
+}
+
+const Scene::ObjectBucket* Scene::find_bucket(const BucketMap& buckets, entt::id_type id, std::string_view key) {
+    auto it = buckets.find(id);
+    if (it == buckets.end()) return nullptr;
+    for (const auto& bucket : it->second) {
+        if (bucket.key == key) return &bucket;
+    }
+    return nullptr;
+}
+
+const Scene::ObjectBucket* Scene::find_unique_bucket(const BucketMap& buckets, entt::id_type id) {
+    auto it = buckets.find(id);
+    if (it == buckets.end()) return nullptr;
+    const ObjectBucket* found = nullptr;
+    for (const auto& bucket : it->second) {
+        if (bucket.objects.empty()) continue;
+        if (found) return nullptr;      // 多个字符串共用这个 id，无法区分
+        found = &bucket;
+    }
+    return found;
+}
+
 void Scene::process_pending_additions() {
     // 处理待添加的游戏对象
     for (auto& game_object : pending_additions_) {
@@ -1,6 +1,7 @@
 #include "engine/scene/scene_manager.hpp"
 #include "engine/core/context.hpp"
 #include "engine/scene/scene.hpp"
+#include "engine/utils/profiler.hpp"
 #include "entt/signal/dispatcher.hpp"
 #include <spdlog/spdlog.h>
 
@@ -30,6 +31,7 @@ engine::core::Context& SceneManager::get_context() const {
 }
 
 void SceneManager::update(sf::Time delta_time) {
+    ENGINE_PROFILE_ZONE(context_.get_profiler(), "SceneManager::update");
     // 只更新栈顶（当前）场景
     Scene* current_scene = get_current_scene();
     if (current_scene) {
@@ -40,6 +42,7 @@ void SceneManager::update(sf::Time delta_time) {
 }
 
 void SceneManager::render() {
+    ENGINE_PROFILE_ZONE(context_.get_profiler(), "SceneManager::render");
     // 渲染时需要叠加渲染所有场景，而不只是栈顶
     for (const auto& scene : scene_stack_) {
         if (scene) {
@@ -99,6 +102,11 @@ void SceneManager::push_scene(std::unique_ptr<Scene>&& scene) {
     }
     spdlog::debug("正在将场景 '{}' 压入栈。", scene->get_name());
 
+    // 原栈顶场景不再更新，但仍会被渲染，需要停止插值
+    if (!scene_stack_.empty()) {
+        scene_stack_.back()->settle_interpolation();
+    }
+
     // 将新场景移入栈顶
     scene_stack_.push_back(std::move(scene));
 }
@@ -0,0 +1,265 @@
+#include "engine/spatial/spatial_grid.hpp"
+#include "engine/core/job_system.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace engine::spatial {
+namespace {
+constexpr float MAX_COORD = static_cast<float>(1 << 30);   // 格子坐标的范围（无穷大的查询半径被钳制到这里）
+
+int to_coord(float value) {
+    return static_cast<int>(std::clamp(std::floor(value), -MAX_COORD, MAX_COORD));
+}
+
+float distance_squared(sf::Vector2f a, sf::Vector2f b) {
+    const sf::Vector2f d = a - b;
+    return d.x * d.x + d.y * d.y;
+}
+
+bool matches(entt::id_type item_tag, entt::id_type tag_id) {
+    return tag_id == ANY_TAG || item_tag == tag_id;
+}
+} // namespace
+
+SpatialGrid::SpatialGrid(float cell_size)
+    : cell_size_{cell_size > 0.f ? cell_size : DEFAULT_CELL_SIZE}
+    , inv_cell_size_{1.f / cell_size_} {
+    if (cell_size <= 0.f) {
+        spdlog::warn("SpatialGrid: 格子边长 {} 无效，使用默认值 {}", cell_size, DEFAULT_CELL_SIZE);
+    }
+}
+
+sf::Vector2i SpatialGrid::cell_coord(sf::Vector2f position) const {
+    return {to_coord(position.x * inv_cell_size_), to_coord(position.y * inv_cell_size_)};
+}
+
+std::uint64_t SpatialGrid::cell_key(sf::Vector2i coord) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(coord.x)) << 32) | static_cast<std::uint32_t>(coord.y);
+}
+
+sf::Vector2i SpatialGrid::key_coord(std::uint64_t key) {
+    return {static_cast<std::int32_t>(key >> 32), static_cast<std::int32_t>(key & 0xFFFFFFFFu)};
+}
+
+const SpatialGrid::Cell* SpatialGrid::find_cell(sf::Vector2i coord) const {
+    auto it = cells_.find(cell_key(coord));
+    return it != cells_.end() && !it->second.empty() ? &it->second : nullptr;
+}
+
+void SpatialGrid::update(entt::entity entity, engine::object::GameObject* object, sf::Vector2f position, entt::id_type tag_id, sf::Vector2f half_extent) {
+    max_half_extent_ = {std::max(max_half_extent_.x, half_extent.x), std::max(max_half_extent_.y, half_extent.y)};
+    const sf::Vector2i coord = cell_coord(position);
+    const std::uint64_t key = cell_key(coord);
+
+    auto [it, inserted] = locations_.try_emplace(entity);
+    Location& location = it->second;
+    if (!inserted) {
+        if (location.key == key) {
+            // 没有跨越格子：就地更新（最常见的情况）
+            Item& item = (*location.cell)[location.slot];
+            item.position = position;
+            item.half_extent = half_extent;
+            item.tag_id = tag_id;
+            item.object = object;
+            return;
+        }
+        erase_slot(*location.cell, location.slot);
+    }
+
+    if (cells_.empty()) {
+        min_coord_ = max_coord_ = coord;
+    } else {
+        min_coord_ = {std::min(min_coord_.x, coord.x), std::min(min_coord_.y, coord.y)};
+        max_coord_ = {std::max(max_coord_.x, coord.x), std::max(max_coord_.y, coord.y)};
+    }
+    Cell& cell = cells_[key];
+    location = {key, &cell, cell.size()};
+    cell.push_back({position, half_extent, tag_id, entity, object});
+}
+
+void SpatialGrid::remove(entt::entity entity) {
+    auto it = locations_.find(entity);
+    if (it == locations_.end()) return;
+    erase_slot(*it->second.cell, it->second.slot);
+    locations_.erase(it);
+}
+
+void SpatialGrid::erase_slot(Cell& cell, std::size_t slot) {
+    if (slot + 1 != cell.size()) {
+        cell[slot] = cell.back();
+        locations_[cell[slot].entity].slot = slot;
+    }
+    cell.pop_back();
+}
+
+void SpatialGrid::clear() {
+    cells_.clear();
+    locations_.clear();
+    min_coord_ = max_coord_ = {};
+    max_half_extent_ = {};
+}
+
+template <typename Fn>
+void SpatialGrid::for_each_cell(sf::Vector2i min, sf::Vector2i max, Fn&& fn) const {
+    const auto width = static_cast<std::uint64_t>(static_cast<std::int64_t>(max.x) - min.x + 1);
+    const auto height = static_cast<std::uint64_t>(static_cast<std::int64_t>(max.y) - min.y + 1);
+    if (width * height > cells_.size()) {
+        // 查询区域比所有已分配的格子还多（例如超大半径），直接遍历已分配的格子
+        for (const auto& [key, cell] : cells_) {
+            const sf::Vector2i coord = key_coord(key);
+            if (!cell.empty() && coord.x >= min.x && coord.x <= max.x && coord.y >= min.y && coord.y <= max.y) {
+                fn(cell);
+            }
+        }
+        return;
+    }
+    for (int y = min.y; y <= max.y; ++y) {
+        for (int x = min.x; x <= max.x; ++x) {
+            if (const Cell* cell = find_cell({x, y}); cell) {
+                fn(*cell);
+            }
+        }
+    }
+}
+
+std::size_t SpatialGrid::query_circle(sf::Vector2f center, float radius, std::vector<engine::object::GameObject*>& out, entt::id_type tag_id) const {
+    out.clear();
+    if (radius < 0.f || locations_.empty()) return 0;
+    const float radius_squared = radius * radius;
+    for_each_cell(cell_coord(center - sf::Vector2f{radius, radius}), cell_coord(center + sf::Vector2f{radius, radius}), [&](const Cell& cell) {
+        for (const Item& item : cell) {
+            if (matches(item.tag_id, tag_id) && distance_squared(item.position, center) <= radius_squared) {
+                out.push_back(item.object);
+            }
+        }
+    });
+    return out.size();
+}
+
+std::size_t SpatialGrid::query_rect(const sf::FloatRect& rect, std::vector<engine::object::GameObject*>& out, entt::id_type tag_id) const {
+    out.clear();
+    if (locations_.empty()) return 0;
+    const sf::Vector2f min = rect.position;
+    const sf::Vector2f max = rect.position + rect.size;
+    for_each_cell(cell_coord(min), cell_coord(max), [&](const Cell& cell) {
+        for (const Item& item : cell) {
+            if (matches(item.tag_id, tag_id)
+                && item.position.x >= min.x && item.position.x <= max.x
+                && item.position.y >= min.y && item.position.y <= max.y) {
+                out.push_back(item.object);
+            }
+        }
+    });
+    return out.size();
+}
+
+std::size_t SpatialGrid::query_overlapping(const sf::FloatRect& rect, std::vector<engine::object::GameObject*>& out, entt::id_type tag_id) const {
+    out.clear();
+    if (locations_.empty()) return 0;
+    const sf::Vector2f min = rect.position;
+    const sf::Vector2f max = rect.position + rect.size;
+    for_each_cell(cell_coord(min - max_half_extent_), cell_coord(max + max_half_extent_), [&](const Cell& cell) {
+        for (const Item& item : cell) {
+            if (matches(item.tag_id, tag_id)
+                && item.position.x + item.half_extent.x >= min.x && item.position.x - item.half_extent.x <= max.x
+                && item.position.y + item.half_extent.y >= min.y && item.position.y - item.half_extent.y <= max.y) {
+                out.push_back(item.object);
+            }
+        }
+    });
+    return out.size();
+}
+
+std::size_t SpatialGrid::query_nearest(sf::Vector2f center, std::size_t k, std::vector<engine::object::GameObject*>& out
+                                     , float max_radius, entt::id_type tag_id) const {
+    out.clear();
+    if (k == 0 || max_radius < 0.f || locations_.empty()) return 0;
+
+    const sf::Vector2i origin = cell_coord(center);
+    // 搜索的圈数：不超过包含所有对象的范围，也不超过 max_radius 覆盖的范围
+    std::int64_t max_ring = std::max({static_cast<std::int64_t>(origin.x) - min_coord_.x, static_cast<std::int64_t>(max_coord_.x) - origin.x
+                                    , static_cast<std::int64_t>(origin.y) - min_coord_.y, static_cast<std::int64_t>(max_coord_.y) - origin.y
+                                    , std::int64_t{0}});
+    if (const double limit = std::ceil(static_cast<double>(max_radius) * inv_cell_size_) + 1.0; limit < static_cast<double>(max_ring)) {
+        max_ring = static_cast<std::int64_t>(limit);
+    }
+    const float max_radius_squared = max_radius * max_radius;
+
+    std::vector<std::pair<float, engine::object::GameObject*>> candidates;
+    auto collect = [&](const Cell& cell) {
+        for (const Item& item : cell) {
+            if (!matches(item.tag_id, tag_id)) continue;
+            if (const float d = distance_squared(item.position, center); d <= max_radius_squared) {
+                candidates.emplace_back(d, item.object);
+            }
+        }
+    };
+    auto visit = [&](sf::Vector2i coord) {
+        if (const Cell* cell = find_cell(coord); cell) collect(*cell);
+    };
+
+    const auto by_distance = [](const auto& a, const auto& b) { return a.first < b.first; };
+    for (std::int64_t ring = 0; ring <= max_ring; ++ring) {
+        const int r = static_cast<int>(ring);
+        if (static_cast<std::size_t>(ring) * 8 > cells_.size()) {
+            // 这一圈的格子比所有已分配的格子还多（对象稀疏），剩下的圈改为直接遍历已分配的格子
+            for (const auto& [key, cell] : cells_) {
+                const sf::Vector2i coord = key_coord(key);
+                const std::int64_t distance = std::max(std::abs(static_cast<std::int64_t>(coord.x) - origin.x)
+                                                     , std::abs(static_cast<std::int64_t>(coord.y) - origin.y));
+                if (distance >= ring && distance <= max_ring) collect(cell);
+            }
+            break;
+        }
+        if (r == 0) {
+            visit(origin);
+        } else {
+            for (int x = origin.x - r; x <= origin.x + r; ++x) {
+                visit({x, origin.y - r});
+                visit({x, origin.y + r});
+            }
+            for (int y = origin.y - r + 1; y <= origin.y + r - 1; ++y) {
+                visit({origin.x - r, y});
+                visit({origin.x + r, y});
+            }
+        }
+        // 第 ring 圈之外的对象与中心的距离至少为 ring 个格子
+        if (candidates.size() >= k) {
+            std::nth_element(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(k - 1), candidates.end(), by_distance);
+            const float reach = static_cast<float>(ring) * cell_size_;
+            if (candidates[k - 1].first <= reach * reach) break;
+        }
+    }
+
+    const std::size_t count = std::min(k, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(count), candidates.end(), by_distance);
+    out.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        out.push_back(candidates[i].second);
+    }
+    return count;
+}
+
+engine::object::GameObject* SpatialGrid::find_nearest(sf::Vector2f center, float max_radius, entt::id_type tag_id) const {
+    std::vector<engine::object::GameObject*> result;
+    return query_nearest(center, 1, result, max_radius, tag_id) > 0 ? result.front() : nullptr;
+}
+
+void SpatialGrid::query_circles(std::span<const CircleQuery> queries, std::vector<std::vector<engine::object::GameObject*>>& results
+                              , engine::core::JobSystem* job_system) const {
+    results.resize(queries.size());
+    auto run = [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            query_circle(queries[i].center, queries[i].radius, results[i], queries[i].tag_id);
+        }
+    };
+    if (!job_system || job_system->get_worker_count() == 0 || queries.size() <= BATCH_GRAIN_SIZE) {
+        run(0, queries.size());
+        return;
+    }
+    // 每个查询只写自己的结果，网格本身只读，可以直接并行
+    job_system->wait(job_system->parallel_for(0, queries.size(), BATCH_GRAIN_SIZE, run));
+}
+} // namespace engine::spatial
@@ -0,0 +1,22 @@
+#include "engine/system/animation_system.hpp"
+#include "engine/component/animation_component.hpp"
+#include "engine/component/sprite_component.hpp"
+#include "engine/object/game_object.hpp"
+
+namespace engine::system {
+AnimationSystem::AnimationSystem()
+    : System{"AnimationSystem"} {
+    reads<engine::object::PendingRemoval>();
+    writes<engine::component::AnimationComponent, engine::component::SpriteComponent>();
+}
+
+void AnimationSystem::update(engine::object::ObjectRegistry& registry, sf::Time delta, engine::core::Context&) {
+    auto view = registry.view<engine::component::AnimationComponent>(entt::exclude<engine::object::PendingRemoval>);
+    for (auto [entity, animation] : view.each()) {
+        if (animation.advance(delta)) {
+            // 移除会修改 PendingRemoval 存储，延迟到所有系统执行完后进行
+            defer([owner = animation.get_owner()](engine::core::Context&) { owner->set_need_remove(true); });
+        }
+    }
+}
+} // namespace engine::system
@@ -0,0 +1,17 @@
+#include "engine/system/health_system.hpp"
+#include "engine/component/health_component.hpp"
+
+namespace engine::system {
+HealthSystem::HealthSystem()
+    : System{"HealthSystem"} {
+    reads<engine::object::PendingRemoval>();
+    writes<engine::component::HealthComponent>();
+}
+
+void HealthSystem::update(engine::object::ObjectRegistry& registry, sf::Time delta, engine::core::Context&) {
+    auto view = registry.view<engine::component::HealthComponent>(entt::exclude<engine::object::PendingRemoval>);
+    for (auto [entity, health] : view.each()) {
+        health.tick_invincibility(delta);
+    }
+}
+} // namespace engine::system
@@ -0,0 +1,22 @@
+#include "engine/system/spatial_index_system.hpp"
+#include "engine/component/transform_component.hpp"
+#include "engine/object/game_object.hpp"
+#include "engine/spatial/spatial_grid.hpp"
+
+namespace engine::system {
+SpatialIndexSystem::SpatialIndexSystem(engine::spatial::SpatialGrid& grid)
+    : System{"SpatialIndexSystem"}
+    , grid_{grid} {
+    reads<engine::component::TransformComponent, engine::object::ObjectLink, engine::object::PendingRemoval>();
+    writes<engine::spatial::SpatialIndexed>();
+}
+
+void SpatialIndexSystem::update(engine::object::ObjectRegistry& registry, sf::Time, engine::core::Context&) {
+    auto view = registry.view<engine::spatial::SpatialIndexed, engine::component::TransformComponent, engine::object::ObjectLink>(
+        entt::exclude<engine::object::PendingRemoval>);
+    view.use<engine::spatial::SpatialIndexed>();
+    for (auto [entity, transform, link] : view.each()) {
+        grid_.update(entity, link.object, transform.get_position(), link.object->get_tag_id());
+    }
+}
+} // namespace engine::system
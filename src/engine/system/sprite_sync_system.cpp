@@ -0,0 +1,37 @@
+#include "engine/system/sprite_sync_system.hpp"
+#include "engine/component/sprite_component.hpp"
+#include "engine/component/transform_component.hpp"
+#include "engine/core/context.hpp"
+#include "engine/core/time.hpp"
+#include "engine/object/game_object.hpp"
+#include "engine/spatial/spatial_grid.hpp"
+
+namespace engine::system {
+SpriteSyncSystem::SpriteSyncSystem(engine::spatial::SpatialGrid& sprite_grid)
+    : System{"SpriteSyncSystem"}
+    , sprite_grid_{sprite_grid} {
+    reads<engine::component::TransformComponent, engine::object::ObjectLink, engine::object::PendingRemoval>();
+    writes<engine::component::SpriteComponent>();
+}
+
+void SpriteSyncSystem::update(engine::object::ObjectRegistry& registry, sf::Time, engine::core::Context& context) {
+    const float alpha = context.get_time().get_interpolation_alpha();
+    const auto& transforms = registry.storage<engine::component::TransformComponent>();
+    // 以精灵的存储驱动遍历，再按实体查找变换（没有变换的精灵保持原位）
+    auto view = registry.view<engine::component::SpriteComponent, engine::object::ObjectLink>(entt::exclude<engine::object::PendingRemoval>);
+    view.use<engine::component::SpriteComponent>();
+    for (auto [entity, sprite, link] : view.each()) {
+        // 延时添加的对象已有 ObjectLink，但在加入场景（get_scene 非空）之前不登记、不绘制
+        if (sprite.is_hidden() || link.object->get_scene() == nullptr) {
+            sprite_grid_.remove(entity);
+            continue;
+        }
+        if (transforms.contains(entity)) {
+            sprite.sync_transform(transforms.get(entity), alpha);
+        }
+        const sf::FloatRect bounds = sprite.get_sprite().getGlobalBounds();
+        const sf::Vector2f half_extent = bounds.size * 0.5f;
+        sprite_grid_.update(entity, link.object, bounds.position + half_extent, link.object->get_tag_id(), half_extent);
+    }
+}
+} // namespace engine::system
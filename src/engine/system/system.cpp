@@ -0,0 +1,23 @@
+#include "engine/system/system.hpp"
+
+namespace engine::system {
+System::System(std::string_view name)
+    : name_{name}
+    , zone_{engine::utils::Profiler::register_zone(name)} {
+}
+
+void System::prepare(engine::object::ObjectRegistry& registry) const {
+    for (auto* preparer : preparers_) {
+        preparer(registry);
+    }
+}
+
+void System::flush_deferred(engine::core::Context& context) {
+    // 命令执行时可能再次 defer，所以先交换出来
+    auto commands = std::move(deferred_);
+    deferred_.clear();
+    for (auto& command : commands) {
+        command(context);
+    }
+}
+} // namespace engine::system
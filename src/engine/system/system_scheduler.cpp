@@ -0,0 +1,93 @@
+#include "engine/system/system_scheduler.hpp"
+#include "engine/core/context.hpp"
+#include "engine/core/job_system.hpp"
+#include <entt/graph/flow.hpp>
+#include <spdlog/spdlog.h>
+
+namespace engine::system {
+namespace {
+void run_system(System& system, engine::object::ObjectRegistry& registry, sf::Time delta, engine::core::Context& context) {
+    engine::utils::ScopedZone zone{context.get_profiler(), system.get_zone()};
+    system.update(registry, delta, context);
+}
+} // namespace
+
+SystemScheduler::~SystemScheduler() = default;
+
+void SystemScheduler::add(std::unique_ptr<System> system) {
+    if (!system) {
+        spdlog::warn("尝试向调度器添加空系统。");
+        return;
+    }
+    systems_.push_back(std::move(system));
+    dirty_ = true;
+}
+
+void SystemScheduler::run(engine::object::ObjectRegistry& registry, sf::Time delta, engine::core::Context& context) {
+    if (systems_.empty()) return;
+    if (dirty_) rebuild_graph();
+
+    for (const auto& system : systems_) {
+        system->prepare(registry);
+    }
+
+    auto& job_system = context.get_job_system();
+    if (!has_parallelism_) {
+        // 依赖图是一条链，按添加顺序直接执行，省去调度开销
+        for (auto& system : systems_) {
+            run_system(*system, registry, delta, context);
+        }
+    } else {
+        // 依赖总是指向下标更小的系统，按下标顺序提交即可保证依赖的句柄已经存在
+        std::vector<engine::core::JobSystem::JobHandle> handles(systems_.size());
+        std::vector<engine::core::JobSystem::JobHandle> dependencies;
+        for (std::size_t i = 0; i < systems_.size(); ++i) {
+            dependencies.clear();
+            for (const std::size_t dependency : dependencies_[i]) {
+                dependencies.push_back(handles[dependency]);
+            }
+            handles[i] = job_system.schedule([&, i] { run_system(*systems_[i], registry, delta, context); }, dependencies);
+        }
+        for (const auto& handle : handles) {
+            job_system.wait(handle);
+        }
+    }
+
+    // 确定性合并：按添加顺序执行延迟命令
+    for (auto& system : systems_) {
+        system->flush_deferred(context);
+    }
+}
+
+void SystemScheduler::rebuild_graph() {
+    entt::flow builder;
+    const auto registry_id = entt::type_hash<engine::object::ObjectRegistry>::value();
+    for (std::size_t i = 0; i < systems_.size(); ++i) {
+        const auto& system = *systems_[i];
+        builder.bind(static_cast<entt::id_type>(i));
+        // 与 entt::organizer 相同：独占系统对注册表本身读写，其他系统只读注册表
+        builder.set(registry_id, system.is_exclusive());
+        builder.ro(system.get_reads().begin(), system.get_reads().end());
+        builder.rw(system.get_writes().begin(), system.get_writes().end());
+    }
+
+    const auto graph = builder.graph();
+    dependencies_.assign(systems_.size(), {});
+    has_parallelism_ = false;
+    for (const auto vertex : graph.vertices()) {
+        for (const auto [from, to] : graph.in_edges(vertex)) {
+            dependencies_[to].push_back(from);
+        }
+        // 依赖图经过传递约简：除第一个系统外，任何不依赖前一个系统的系统都可以与它并行
+        if (vertex > 0 && (dependencies_[vertex].size() != 1 || dependencies_[vertex].front() != vertex - 1)) {
+            has_parallelism_ = true;
+        }
+    }
+    dirty_ = false;
+
+    for (std::size_t i = 0; i < systems_.size(); ++i) {
+        spdlog::trace("系统 '{}' 依赖 {} 个系统{}", systems_[i]->get_name(), dependencies_[i].size()
+                    , systems_[i]->is_exclusive() ? "（独占）" : "");
+    }
+}
+} // namespace engine::system
@@ -17,12 +17,12 @@ UIButton::UIButton(engine::core::Context& context
                   , std::move(size)}
     , callback_{std::move(callback)} {
     auto& resource_manager = context.get_resource_manager();
-    auto tex_normal = resource_manager.get_texture(normal_sprite_id);
-    auto tex_hover = resource_manager.get_texture(hover_sprite_id);
-    auto tex_pressed = resource_manager.get_texture(pressed_sprite_id);
-    add_sprite("normal", std::make_unique<sf::Sprite>(*tex_normal));
-    add_sprite("hover", std::make_unique<sf::Sprite>(*tex_hover));
-    add_sprite("pressed", std::make_unique<sf::Sprite>(*tex_pressed));
+    auto tex_normal = resource_manager.load_texture_region(normal_sprite_id);
+    auto tex_hover = resource_manager.load_texture_region(hover_sprite_id);
+    auto tex_pressed = resource_manager.load_texture_region(pressed_sprite_id);
+    add_sprite("normal", std::make_unique<sf::Sprite>(*tex_normal.texture, tex_normal.rect));
+    add_sprite("hover", std::make_unique<sf::Sprite>(*tex_hover.texture, tex_hover.rect));
+    add_sprite("pressed", std::make_unique<sf::Sprite>(*tex_pressed.texture, tex_pressed.rect));
 
     // 设置默认状态为"normal"
     set_state(std::make_unique<engine::ui::state::UINormalState>(this));
@@ -1,6 +1,8 @@
 #include "engine/ui/ui_manager.hpp"
 #include "engine/ui/ui_panel.hpp"
 #include "engine/ui/ui_element.hpp"
+#include "engine/core/context.hpp"
+#include "engine/utils/profiler.hpp"
 #include <spdlog/spdlog.h>
 
 namespace engine::ui {
@@ -38,6 +40,7 @@ bool UIManager::handle_input(engine::core::Context& context) {
 }
 
 void UIManager::update(sf::Time delta, engine::core::Context& context) {
+    ENGINE_PROFILE_ZONE(context.get_profiler(), "UIManager::update");
     if (root_element_ && root_element_->is_visible()) {
         // 从根元素开始向下更新
         root_element_->update(delta, context);
@@ -45,6 +48,7 @@ void UIManager::update(sf::Time delta, engine::core::Context& context) {
 }
 
 void UIManager::render(engine::core::Context& context) {
+    ENGINE_PROFILE_ZONE(context.get_profiler(), "UIManager::render");
     if (root_element_ && root_element_->is_visible()) {
         // 从根元素开始向下渲染
         root_element_->render(context);
@@ -0,0 +1,86 @@
+#include "engine/utils/arena.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <new>
+
+namespace engine::utils {
+void Arena::BlockDeleter::operator()(std::byte* block) const {
+    ::operator delete(block, std::align_val_t{SIZE_CLASS_GRANULARITY});
+}
+
+Arena::Arena(std::size_t block_size)
+    : block_size_{std::max(block_size, MAX_SMALL_SIZE)} {
+}
+
+Arena::~Arena() {
+    // 正常情况下大对象都已经归还，这里只是兜底
+    for (const auto& [ptr, alignment] : large_allocations_) {
+        ::operator delete(ptr, std::align_val_t{alignment});
+    }
+    spdlog::trace("Arena 释放 {} 个内存块，峰值使用 {} 字节，共申请 {} 字节",
+                  stats_.block_count, stats_.high_water_bytes, stats_.reserved_bytes);
+}
+
+void* Arena::allocate(std::size_t bytes, std::size_t alignment) {
+    if (!is_small(bytes, alignment)) {
+        // 大对象直接向系统申请
+        const std::size_t large_alignment = std::max(alignment, SIZE_CLASS_GRANULARITY);
+        void* ptr = ::operator new(bytes, std::align_val_t{large_alignment});
+        large_allocations_.emplace(ptr, large_alignment);
+        stats_.reserved_bytes += bytes;
+        track_allocation(bytes);
+        return ptr;
+    }
+
+    const std::size_t index = size_class(bytes);
+    const std::size_t class_size = (index + 1) * SIZE_CLASS_GRANULARITY;
+    track_allocation(class_size);
+    // 优先复用同一尺寸等级中已释放的内存
+    if (FreeNode* node = free_lists_[index]; node) {
+        free_lists_[index] = node->next;
+        return node;
+    }
+    return allocate_from_block(class_size);
+}
+
+void Arena::deallocate(void* ptr, std::size_t bytes, std::size_t alignment) {
+    if (!ptr) return;
+    if (!is_small(bytes, alignment)) {
+        if (auto it = large_allocations_.find(ptr); it != large_allocations_.end()) {
+            ::operator delete(ptr, std::align_val_t{it->second});
+            large_allocations_.erase(it);
+            stats_.reserved_bytes -= bytes;
+            stats_.live_bytes -= bytes;
+        } else {
+            spdlog::error("Arena::deallocate: 地址 {} 不是由此内存池分配的大对象", ptr);
+        }
+        return;
+    }
+
+    const std::size_t index = size_class(bytes);
+    auto* node = static_cast<FreeNode*>(ptr);
+    node->next = free_lists_[index];
+    free_lists_[index] = node;
+    stats_.live_bytes -= (index + 1) * SIZE_CLASS_GRANULARITY;
+}
+
+void* Arena::allocate_from_block(std::size_t bytes) {
+    if (static_cast<std::size_t>(block_end_ - cursor_) < bytes) {
+        // 当前块剩余的尾部不再使用（最多 MAX_SMALL_SIZE 字节）
+        blocks_.emplace_back(static_cast<std::byte*>(::operator new(block_size_, std::align_val_t{SIZE_CLASS_GRANULARITY})));
+        cursor_ = blocks_.back().get();
+        block_end_ = cursor_ + block_size_;
+        stats_.reserved_bytes += block_size_;
+        ++stats_.block_count;
+    }
+    void* ptr = cursor_;
+    cursor_ += bytes;
+    return ptr;
+}
+
+void Arena::track_allocation(std::size_t bytes) {
+    stats_.live_bytes += bytes;
+    stats_.high_water_bytes = std::max(stats_.high_water_bytes, stats_.live_bytes);
+    ++stats_.allocation_count;
+}
+} // namespace engine::utils
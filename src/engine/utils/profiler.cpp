@@ -0,0 +1,195 @@
+#include "engine/utils/profiler.hpp"
+#include <imgui.h>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#include <cstdlib>
+#endif
+
+namespace engine::utils {
+namespace {
+/**
+ * @brief 全局计时区域注册表，名称只追加不删除，因此 ZoneId 在进程内稳定
+ */
+struct ZoneRegistry {
+    std::mutex mutex;
+    std::vector<std::string> names;
+    std::unordered_map<std::string, Profiler::ZoneId> by_name;
+    std::array<std::unordered_map<std::type_index, Profiler::ZoneId>, 3> by_component;    // 按 ComponentPhase 分组
+};
+
+ZoneRegistry& registry() {
+    static ZoneRegistry instance;
+    return instance;
+}
+
+Profiler::ZoneId register_locked(ZoneRegistry& reg, std::string name) {
+    if (auto it = reg.by_name.find(name); it != reg.by_name.end()) {
+        return it->second;
+    }
+    if (reg.names.size() >= Profiler::MAX_ZONES) {
+        spdlog::warn("Profiler: 计时区域数量超过上限 {}，忽略区域 '{}'", Profiler::MAX_ZONES, name);
+        return Profiler::INVALID_ZONE;
+    }
+    auto id = static_cast<Profiler::ZoneId>(reg.names.size());
+    reg.names.push_back(name);
+    reg.by_name.emplace(std::move(name), id);
+    return id;
+}
+
+/// @brief 获取可读的类型名（去掉命名空间前缀）
+std::string readable_type_name(std::type_index type) {
+    std::string name = type.name();
+#if defined(__GNUG__)
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (status == 0 && demangled) {
+        name = demangled;
+    }
+    std::free(demangled);
+#endif
+    if (auto pos = name.rfind("::"); pos != std::string::npos) {
+        name = name.substr(pos + 2);
+    }
+    return name;
+}
+
+constexpr std::string_view phase_name(ComponentPhase phase) {
+    switch (phase) {
+        case ComponentPhase::HandleInput: return "handle_input";
+        case ComponentPhase::Update: return "update";
+        case ComponentPhase::Render: return "render";
+    }
+    return "unknown";
+}
+} // namespace
+
+Profiler::Profiler()
+    : history_{std::make_unique<std::array<History, MAX_ZONES>>()} {
+    spdlog::trace("Profiler 初始化完成");
+}
+
+Profiler::~Profiler() = default;
+
+Profiler::ZoneId Profiler::register_zone(std::string_view name) {
+    auto& reg = registry();
+    std::lock_guard lock(reg.mutex);
+    return register_locked(reg, std::string(name));
+}
+
+Profiler::ZoneId Profiler::register_component_zone(std::type_index type, ComponentPhase phase) {
+    auto& reg = registry();
+    std::lock_guard lock(reg.mutex);
+    auto& cache = reg.by_component[static_cast<std::size_t>(phase)];
+    if (auto it = cache.find(type); it != cache.end()) {
+        return it->second;
+    }
+    auto id = register_locked(reg, readable_type_name(type) + "::" + std::string(phase_name(phase)));
+    cache.emplace(type, id);
+    return id;
+}
+
+void Profiler::set_enabled(bool enabled) {
+    if (enabled == is_enabled()) return;
+    enabled_.store(enabled, std::memory_order_relaxed);
+    // 重新开启时从干净的历史开始，避免混入上一次采集的旧数据
+    for (std::size_t i = 0; i < MAX_ZONES; ++i) {
+        frame_ns_[i].store(0, std::memory_order_relaxed);
+        frame_calls_[i].store(0, std::memory_order_relaxed);
+        (*history_)[i] = History{};
+    }
+    spdlog::info("Profiler 已{}", enabled ? "开启" : "关闭");
+}
+
+void Profiler::record(ZoneId id, std::int64_t nanoseconds) {
+    if (id >= MAX_ZONES) return;
+    frame_ns_[id].fetch_add(nanoseconds, std::memory_order_relaxed);
+    frame_calls_[id].fetch_add(1, std::memory_order_relaxed);
+}
+
+void Profiler::end_frame() {
+    if (!is_enabled()) return;
+
+    for (std::size_t i = 0; i < MAX_ZONES; ++i) {
+        auto calls = frame_calls_[i].exchange(0, std::memory_order_relaxed);
+        auto ns = frame_ns_[i].exchange(0, std::memory_order_relaxed);
+        auto& history = (*history_)[i];
+        history.last_calls = calls;
+        if (calls == 0) {
+            history.last_ms = 0.f;
+            continue;       // 本帧没有经过该区域，不计入历史（避免把 0 算进最小值）
+        }
+        history.last_ms = static_cast<float>(ns) / 1.0e6f;
+        history.samples_ms[history.next] = history.last_ms;
+        history.next = (history.next + 1) % HISTORY_SIZE;
+        history.count = std::min(history.count + 1, HISTORY_SIZE);
+    }
+}
+
+std::vector<Profiler::ZoneStats> Profiler::collect_stats() const {
+    std::vector<std::string> names;
+    {
+        auto& reg = registry();
+        std::lock_guard lock(reg.mutex);
+        names = reg.names;
+    }
+
+    std::vector<ZoneStats> result;
+    std::vector<float> sorted;
+    sorted.reserve(HISTORY_SIZE);
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        const auto& history = (*history_)[i];
+        if (history.count == 0) continue;
+
+        sorted.assign(history.samples_ms.begin(), history.samples_ms.begin() + history.count);
+        std::sort(sorted.begin(), sorted.end());
+        float sum = 0.f;
+        for (float sample : sorted) sum += sample;
+        auto p99_index = std::min(sorted.size() - 1, (sorted.size() * 99) / 100);
+
+        result.push_back(ZoneStats{names[i]
+                                 , history.last_calls
+                                 , history.last_ms
+                                 , sorted.front()
+                                 , sum / static_cast<float>(sorted.size())
+                                 , sorted[p99_index]});
+    }
+    return result;
+}
+
+void Profiler::draw_overlay() const {
+    auto stats = collect_stats();
+    // 按平均耗时降序，最热的区域排在最上面
+    std::sort(stats.begin(), stats.end(), [](const ZoneStats& a, const ZoneStats& b) { return a.avg_ms > b.avg_ms; });
+
+    ImGui::SetNextWindowPos(ImVec2(10.f, 10.f), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowBgAlpha(0.8f);
+    if (ImGui::Begin("Profiler (F3)", nullptr, ImGuiWindowFlags_AlwaysAutoResize)) {
+        ImGui::Text("history: last %zu frames, unit: ms per frame", HISTORY_SIZE);
+        constexpr ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit;
+        if (ImGui::BeginTable("profiler_zones", 6, flags)) {
+            ImGui::TableSetupColumn("zone");
+            ImGui::TableSetupColumn("calls");
+            ImGui::TableSetupColumn("last");
+            ImGui::TableSetupColumn("min");
+            ImGui::TableSetupColumn("avg");
+            ImGui::TableSetupColumn("p99");
+            ImGui::TableHeadersRow();
+            for (const auto& zone : stats) {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::TextUnformatted(zone.name.c_str());
+                ImGui::TableNextColumn(); ImGui::Text("%u", zone.calls);
+                ImGui::TableNextColumn(); ImGui::Text("%.3f", zone.last_ms);
+                ImGui::TableNextColumn(); ImGui::Text("%.3f", zone.min_ms);
+                ImGui::TableNextColumn(); ImGui::Text("%.3f", zone.avg_ms);
+                ImGui::TableNextColumn(); ImGui::Text("%.3f", zone.p99_ms);
+            }
+            ImGui::EndTable();
+        }
+    }
+    ImGui::End();
+}
+} // namespace engine::utils
@@ -0,0 +1,157 @@
+#include "game/data/blueprint_pools.hpp"
+#include "game/data/blueprint_registry.hpp"
+#include "engine/component/animation_component.hpp"
+#include "engine/component/transform_component.hpp"
+#include "engine/object/game_object.hpp"
+#include "engine/object/object_pool.hpp"
+#include "engine/scene/scene.hpp"
+#include <entt/core/hashed_string.hpp>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <fstream>
+
+namespace game::data {
+BlueprintPools::BlueprintPools(engine::scene::Scene& scene, const BlueprintRegistry& blueprints)
+    : scene_{scene}
+    , blueprints_{blueprints} {
+    for (const auto& blueprint : blueprints_.get_enemies()) add_pool(blueprint);
+    for (const auto& blueprint : blueprints_.get_projectiles()) add_pool(blueprint);
+    for (const auto& blueprint : blueprints_.get_effects()) add_pool(blueprint);
+}
+
+BlueprintPools::~BlueprintPools() = default;
+
+template <typename Blueprint>
+void BlueprintPools::add_pool(const Blueprint& blueprint) {
+    // 工厂与恢复函数捕获蓝图指针：注册表加载之后蓝图地址不变
+    auto pool = std::make_unique<engine::object::ObjectPool>(blueprint.key
+        , [this, bp = &blueprint]() { return BlueprintRegistry::spawn(scene_, *bp, {}); }
+        , [bp = &blueprint](engine::object::GameObject& object) { BlueprintRegistry::restore(object, *bp); });
+    if (!pools_.emplace(blueprint.id, std::move(pool)).second) {
+        spdlog::warn("蓝图 '{}' 的 id 与已有对象池重复，不为其创建对象池", blueprint.key);
+    }
+}
+
+bool BlueprintPools::plan_warm_up(std::size_t level_index, std::string_view path) {
+    std::unordered_map<entt::id_type, std::size_t> counts;
+    for (const auto& blueprint : blueprints_.get_projectiles()) counts[blueprint.id] = DEFAULT_PROJECTILE_WARM_UP;
+    for (const auto& blueprint : blueprints_.get_effects()) counts[blueprint.id] = DEFAULT_EFFECT_WARM_UP;
+
+    bool success = false;
+    if (std::ifstream file{std::string(path)}; !file.is_open()) {
+        spdlog::error("无法打开关卡配置文件 '{}'，只按默认数量预热对象池", path);
+    } else {
+        try {
+            const auto json = nlohmann::json::parse(file);
+            if (!json.is_array() || level_index >= json.size()) {
+                spdlog::error("关卡配置 '{}' 中没有下标为 {} 的关卡", path, level_index);
+            } else {
+                const auto& level = json[level_index];
+                // 同一波的敌人可能同时存活，按单波中的最大数量预热
+                for (const auto& wave : level.value("waves", nlohmann::json::array())) {
+                    for (const auto& [key, count] : wave.value("enemy_types", nlohmann::json::object()).items()) {
+                        auto& warm_up = counts[entt::hashed_string::value(key.data(), key.size())];
+                        warm_up = std::max(warm_up, count.get<std::size_t>());
+                    }
+                }
+                for (const auto& [key, count] : level.value("pool_warm_up", nlohmann::json::object()).items()) {
+                    counts[entt::hashed_string::value(key.data(), key.size())] = count.get<std::size_t>();
+                }
+                success = true;
+            }
+        } catch (const nlohmann::json::exception& e) {
+            spdlog::error("解析关卡配置 '{}' 失败: {}", path, e.what());
+        }
+    }
+
+    // 已经创建过的对象（之前的预热或未命中时新建的）计入预热数量
+    warm_up_queue_.clear();
+    std::size_t total = 0;
+    for (const auto& [id, count] : counts) {
+        auto* pool = get_pool(id);
+        if (!pool || pool->get_stats().created >= count) continue;
+        const std::size_t missing = count - pool->get_stats().created;
+        warm_up_queue_.emplace_back(pool, missing);
+        total += missing;
+    }
+    spdlog::debug("对象池预热计划：关卡 {}，共 {} 个对象", level_index, total);
+    return success;
+}
+
+std::size_t BlueprintPools::warm_up_step(std::size_t max_objects) {
+    std::size_t created = 0;
+    while (created < max_objects && !warm_up_queue_.empty()) {
+        auto& [pool, remaining] = warm_up_queue_.back();
+        const std::size_t count = std::min(remaining, max_objects - created);
+        const std::size_t created_before = pool->get_stats().created;
+        pool->warm_up(pool->get_stats().idle + count);
+        const std::size_t made = pool->get_stats().created - created_before;
+        created += made;
+        remaining -= count;
+        // 工厂没有返回对象时放弃这个对象池（错误已由对象池输出）
+        if (remaining == 0 || made < count) warm_up_queue_.pop_back();
+    }
+    if (created > 0 && warm_up_queue_.empty()) spdlog::debug("对象池预热完成");
+    return created;
+}
+
+template <typename Blueprint>
+std::unique_ptr<engine::object::GameObject> BlueprintPools::acquire(const Blueprint& blueprint, sf::Vector2f position) {
+    engine::object::ObjectPool* pool = get_pool(blueprint.id);
+    if (!pool) {
+        // 不是由本对象创建的蓝图（例如注册表之后才加入），退回到直接生成
+        return BlueprintRegistry::spawn(scene_, blueprint, position);
+    }
+    std::unique_ptr<engine::object::GameObject> object = pool->acquire();
+    if (!object) return nullptr;
+    if (auto* transform = object->get_component<engine::component::TransformComponent>(); transform) {
+        transform->set_position(position);         // set_position 同时重置插值起点，不会从旧位置插值
+    }
+    return object;
+}
+
+std::unique_ptr<engine::object::GameObject> BlueprintPools::spawn(const EnemyBlueprint& blueprint, sf::Vector2f position) {
+    auto object = acquire(blueprint, position);
+    if (auto* animation = object ? object->get_component<engine::component::AnimationComponent>() : nullptr; animation) {
+        animation->play_animation(ENEMY_INITIAL_ANIMATION);
+    }
+    return object;
+}
+
+std::unique_ptr<engine::object::GameObject> BlueprintPools::spawn(const ProjectileBlueprint& blueprint, sf::Vector2f position) {
+    return acquire(blueprint, position);
+}
+
+std::unique_ptr<engine::object::GameObject> BlueprintPools::spawn(const EffectBlueprint& blueprint, sf::Vector2f position) {
+    auto object = acquire(blueprint, position);
+    if (auto* animation = object ? object->get_component<engine::component::AnimationComponent>() : nullptr; animation) {
+        animation->play_animation(blueprint.key);
+    }
+    return object;
+}
+
+engine::object::ObjectPool* BlueprintPools::get_pool(entt::id_type blueprint_id) const {
+    auto it = pools_.find(blueprint_id);
+    return it != pools_.end() ? it->second.get() : nullptr;
+}
+
+std::vector<BlueprintPools::PoolReport> BlueprintPools::collect_stats() const {
+    std::vector<PoolReport> reports;
+    reports.reserve(pools_.size());
+    for (const auto& [id, pool] : pools_) {
+        const auto& stats = pool->get_stats();
+        reports.push_back({std::string(pool->get_name()), stats.hits, stats.misses, stats.created, stats.peak_in_use, pool->get_hit_rate()});
+    }
+    std::ranges::sort(reports, {}, &PoolReport::name);
+    return reports;
+}
+
+void BlueprintPools::log_stats() const {
+    for (const auto& report : collect_stats()) {
+        if (report.hits + report.misses == 0) continue;
+        spdlog::info("对象池 '{}'：命中率 {:.1f}%（命中 {}，未命中 {}），共创建 {} 个，使用峰值 {}",
+                     report.name, report.hit_rate * 100.f, report.hits, report.misses, report.created, report.peak_in_use);
+    }
+}
+} // namespace game::data
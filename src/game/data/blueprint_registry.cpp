@@ -0,0 +1,421 @@
+#include "game/data/blueprint_registry.hpp"
+#include "engine/component/animation_component.hpp"
+#include "engine/component/audio_component.hpp"
+#include "engine/component/health_component.hpp"
+#include "engine/component/sprite_component.hpp"
+#include "engine/component/transform_component.hpp"
+#include "engine/core/context.hpp"
+#include "engine/object/game_object.hpp"
+#include "engine/render/animation.hpp"
+#include "engine/resource/resource_manager.hpp"
+#include "engine/scene/scene.hpp"
+#include "engine/spatial/spatial_grid.hpp"
+#include <entt/core/hashed_string.hpp>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+
+namespace game::data {
+struct BlueprintRegistry::LoadContext {
+    engine::resource::ResourceManager& resource_manager;
+    bool load_textures;                                         ///< @brief 是否加载精灵表纹理（无头模式不加载）
+    std::unordered_map<std::string, std::string> sound_paths;   ///< @brief 音效键名 -> 路径（来自 resource_mapping.json）
+};
+
+namespace {
+constexpr int DEFAULT_FRAME_DURATION_MS = 100;      // 未指定 duration 时每帧的时长（毫秒）
+
+entt::id_type to_id(std::string_view key) {
+    return entt::hashed_string::value(key.data(), key.size());
+}
+
+std::optional<nlohmann::json> read_json(const std::filesystem::path& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        spdlog::error("无法打开数据文件 '{}'", path.string());
+        return std::nullopt;
+    }
+    try {
+        nlohmann::json json;
+        file >> json;
+        return json;
+    } catch (const nlohmann::json::parse_error& e) {
+        spdlog::error("解析数据文件 '{}' 失败：{}", path.string(), e.what());
+    }
+    return std::nullopt;
+}
+
+template <typename Blueprint>
+const Blueprint* find_in(const std::vector<Blueprint>& blueprints, const std::unordered_map<entt::id_type, std::size_t>& index, entt::id_type id) {
+    auto it = index.find(id);
+    return it != index.end() ? &blueprints[it->second] : nullptr;
+}
+
+/// @brief 把新蓝图加入容器与索引，键名哈希冲突时放弃新蓝图
+template <typename Blueprint>
+void insert_blueprint(std::vector<Blueprint>& blueprints, std::unordered_map<entt::id_type, std::size_t>& index, Blueprint&& blueprint) {
+    auto [it, inserted] = index.emplace(blueprint.id, blueprints.size());
+    if (!inserted) {
+        spdlog::error("蓝图 '{}' 与 '{}' 的键名重复或哈希冲突，已跳过", blueprint.key, blueprints[it->second].key);
+        return;
+    }
+    blueprints.push_back(std::move(blueprint));
+}
+
+/// @brief 没有纹理的精灵（无头模式）使用的空纹理：默认构造的 sf::Texture 不创建 GL 对象
+const sf::Texture& no_texture() {
+    static const sf::Texture texture;
+    return texture;
+}
+
+/**
+ * @brief 解析精灵显示数据（sprite_sheet/x/y/width/height/size_x/size_y/offset_x/offset_y/face_right）
+ * @param load_textures 为 false 时不加载纹理（无头模式），只解析显示区域
+ * @return bool 纹理加载失败时返回 false
+ */
+bool parse_sprite(const nlohmann::json& json, std::string_view key, engine::resource::ResourceManager& resource_manager, bool load_textures, SpriteBlueprint& sprite) {
+    const std::string sheet = json.value("sprite_sheet", "");
+    if (sheet.empty()) {
+        spdlog::error("蓝图 '{}' 没有指定精灵表", key);
+        return false;
+    }
+    // 精灵表可能被打包进图集：纹理为图集页，表中的坐标整体平移到精灵表在页中的位置（动画帧以此为基准）
+    // 不加载纹理时也不会构建图集，区域从原图的左上角开始
+    const auto region = load_textures ? resource_manager.load_texture_region(sheet) : engine::resource::TextureRegion{};
+    sprite.texture = region.texture;
+    if (load_textures && !sprite.texture) {
+        spdlog::error("蓝图 '{}' 的精灵表 '{}' 加载失败", key, sheet);
+        return false;
+    }
+    const sf::Vector2i frame_size{json.value("width", 0), json.value("height", 0)};
+    sprite.source_rect = sf::IntRect(region.rect.position + sf::Vector2i{json.value("x", 0), json.value("y", 0)}, frame_size);
+    // size_x/size_y 是显示尺寸，与帧尺寸不同时通过缩放实现
+    const sf::Vector2f display_size{json.value("size_x", static_cast<float>(frame_size.x)), json.value("size_y", static_cast<float>(frame_size.y))};
+    sprite.scale = {frame_size.x > 0 ? display_size.x / static_cast<float>(frame_size.x) : 1.f
+                  , frame_size.y > 0 ? display_size.y / static_cast<float>(frame_size.y) : 1.f};
+    // offset 是精灵左上角相对于对象位置的偏移（显示尺寸下），换算为精灵本地坐标中的原点
+    const sf::Vector2f offset{json.value("offset_x", 0.f), json.value("offset_y", 0.f)};
+    sprite.origin = {-offset.x / sprite.scale.x, -offset.y / sprite.scale.y};
+    sprite.face_right = json.value("face_right", true);
+    return true;
+}
+
+/**
+ * @brief 解析一个动画片段（duration/row/frames/loop/events），帧区域相对于精灵的初始区域
+ * @param default_loop 没有 loop 字段时是否循环
+ * @return std::optional<AnimationClip> 缺少 frames 数组时返回空
+ */
+std::optional<AnimationClip> parse_clip(const nlohmann::json& json, std::string_view name, const SpriteBlueprint& sprite, bool default_loop) {
+    if (!json.is_object() || !json.contains("frames") || !json["frames"].is_array()) {
+        spdlog::warn("动画 '{}' 缺少 'frames' 数组", name);
+        return std::nullopt;
+    }
+    bool loop = default_loop;
+    if (auto it = json.find("loop"); it != json.end()) {
+        if (it->is_boolean()) {
+            loop = it->get<bool>();
+        } else {
+            spdlog::warn("动画 '{}' 的 loop 不是布尔值，使用默认值 {}", name, default_loop);
+        }
+    }
+    const sf::Time duration = sf::milliseconds(json.value("duration", DEFAULT_FRAME_DURATION_MS));
+    const int row = json.value("row", 0);
+    const sf::Vector2i base = sprite.source_rect.position;
+    const sf::Vector2i size = sprite.source_rect.size;
+
+    auto animation = std::make_shared<engine::render::Animation>(name, loop);
+    for (const auto& frame : json["frames"]) {
+        if (!frame.is_number_integer()) {
+            spdlog::warn("动画 '{}' 中 frames 数组格式错误", name);
+            continue;
+        }
+        const int column = frame.get<int>();
+        animation->add_frame(sf::IntRect({base.x + column * size.x, base.y + row * size.y}, size), duration);
+    }
+
+    AnimationClip clip;
+    clip.animation = std::move(animation);
+    if (json.contains("events") && json["events"].is_object()) {
+        for (const auto& [event_name, frame] : json["events"].items()) {
+            if (!frame.is_number_integer()) {
+                spdlog::warn("动画 '{}' 的事件 '{}' 的帧号不是整数，已忽略", name, event_name);
+                continue;
+            }
+            clip.events.push_back(AnimationEvent{event_name, frame.get<int>()});
+        }
+    }
+    return clip;
+}
+
+/**
+ * @brief 解析 animation 对象（动画名 -> 片段），第一帧同步到精灵的初始区域
+ * @note 片段可以用 loop 字段指定是否循环；没有指定时 idle、walk 循环，其余（攻击、受击等）只播放一次
+ */
+std::vector<AnimationClip> parse_clips(const nlohmann::json& json, SpriteBlueprint& sprite) {
+    std::vector<AnimationClip> clips;
+    if (!json.contains("animation") || !json["animation"].is_object()) return clips;
+    const SpriteBlueprint frame_base = sprite;
+    for (const auto& [name, clip_json] : json["animation"].items()) {
+        const bool default_loop = name == "idle" || name == "walk";
+        if (auto clip = parse_clip(clip_json, name, frame_base, default_loop); clip) {
+            clips.push_back(std::move(*clip));
+        }
+    }
+    if (!clips.empty() && !clips.front().animation->is_empty()) {
+        sprite.source_rect = clips.front().animation->get_frames().front().source_rect;
+    }
+    return clips;
+}
+
+/// @brief 解析 sounds 对象（音效 id -> 音效键名），键名通过 resource_mapping.json 解析为路径
+std::vector<SoundBlueprint> parse_sounds(const nlohmann::json& json, const std::unordered_map<std::string, std::string>& sound_paths) {
+    std::vector<SoundBlueprint> sounds;
+    if (!json.contains("sounds") || !json["sounds"].is_object()) return sounds;
+    for (const auto& [id, value] : json["sounds"].items()) {
+        const std::string sound_key = value.get<std::string>();
+        auto it = sound_paths.find(sound_key);
+        // 映射中没有的键名当作路径直接使用（与 AudioComponent::play_sound 一致）
+        sounds.push_back(SoundBlueprint{id, it != sound_paths.end() ? it->second : sound_key});
+    }
+    return sounds;
+}
+
+UnitStats parse_stats(const nlohmann::json& json) {
+    UnitStats stats;
+    stats.hp = json.value("hp", stats.hp);
+    stats.atk = json.value("atk", stats.atk);
+    stats.def = json.value("def", stats.def);
+    stats.range = json.value("range", stats.range);
+    stats.atk_interval = sf::seconds(json.value("atk_interval", stats.atk_interval.asSeconds()));
+    return stats;
+}
+
+entt::id_type parse_projectile(const nlohmann::json& json) {
+    const std::string projectile = json.value("projectile", "");
+    return projectile.empty() ? entt::id_type{} : to_id(projectile);
+}
+
+/**
+ * @brief 按精灵蓝图添加变换与精灵组件（单位与敌人在对象层按 y 排序，投射物与特效在其上）
+ * @note 缩放、原点与纹理区域都在构造时传入，对象池复用对象时 Component::reset 会恢复到这些值
+ */
+engine::object::GameObject& add_display(engine::object::GameObject& object, const SpriteBlueprint& sprite, sf::Vector2f position
+                                      , engine::render::RenderLayer layer = engine::render::RenderLayer::Object) {
+    object.add_component<engine::component::TransformComponent>(position, sprite.scale, sf::degrees(0.f), sprite.origin);
+    auto* sprite_component = object.add_component<engine::component::SpriteComponent>(
+        sf::Sprite(sprite.texture ? *sprite.texture : no_texture(), sprite.source_rect));
+    sprite_component->set_render_layer(layer);
+    return object;
+}
+
+void add_clips(engine::object::GameObject& object, const std::vector<AnimationClip>& clips, std::string_view initial) {
+    if (clips.empty()) return;
+    auto* animation = object.add_component<engine::component::AnimationComponent>();
+    for (const auto& clip : clips) {
+        animation->add_animation(clip.animation);
+    }
+    animation->play_animation(initial);
+}
+
+/// @brief 让对象加入场景的空间网格（用于射程与邻近查询）
+void add_spatial(engine::object::GameObject& object) {
+    object.get_registry().emplace_or_replace<engine::spatial::SpatialIndexed>(object.get_entity());
+}
+
+void add_sounds(engine::object::GameObject& object, const std::vector<SoundBlueprint>& sounds, engine::core::Context& context) {
+    if (sounds.empty()) return;
+    auto* audio = object.add_component<engine::component::AudioComponent>(&context.get_audio_player(), &context.get_camera());
+    for (const auto& sound : sounds) {
+        audio->add_sound(sound.id, sound.path);
+    }
+}
+
+/// @brief 恢复蓝图的名称与标签（使用期间可能被改动，不属于任何组件）
+void restore_identity(engine::object::GameObject& object, std::string_view key, std::string_view tag) {
+    if (object.get_name() != key) object.set_name(key);
+    if (object.get_tag() != tag) object.set_tag(tag);
+}
+} // namespace
+
+BlueprintRegistry::BlueprintRegistry() = default;
+BlueprintRegistry::~BlueprintRegistry() = default;
+
+bool BlueprintRegistry::load(engine::resource::ResourceManager& resource_manager, std::string_view data_dir, bool load_textures) {
+    const std::filesystem::path dir(data_dir);
+    LoadContext load_context{resource_manager, load_textures, {}};
+    if (auto mapping = read_json(dir / "resource_mapping.json"); mapping && mapping->contains("sound")) {
+        load_context.sound_paths = (*mapping)["sound"].get<std::unordered_map<std::string, std::string>>();
+    }
+
+    bool success = true;
+    auto load_file = [&](std::string_view file, auto loader) {
+        auto json = read_json(dir / file);
+        if (!json || !json->is_object()) {
+            success = false;
+            return;
+        }
+        try {
+            success = (this->*loader)(*json, load_context) && success;
+        } catch (const nlohmann::json::exception& e) {
+            spdlog::error("数据文件 '{}' 格式错误：{}", file, e.what());
+            success = false;
+        }
+    };
+    load_file("enemy_data.json", &BlueprintRegistry::load_enemies);
+    load_file("player_data.json", &BlueprintRegistry::load_players);
+    load_file("projectile_data.json", &BlueprintRegistry::load_projectiles);
+    load_file("effect_data.json", &BlueprintRegistry::load_effects);
+
+    spdlog::info("蓝图加载完成：{} 个敌人，{} 个玩家单位，{} 个投射物，{} 个特效",
+                 enemies_.size(), players_.size(), projectiles_.size(), effects_.size());
+    return success;
+}
+
+bool BlueprintRegistry::load_enemies(const nlohmann::json& json, LoadContext& load_context) {
+    bool success = true;
+    for (const auto& [key, entry] : json.items()) {
+        EnemyBlueprint blueprint;
+        blueprint.id = to_id(key);
+        blueprint.key = key;
+        if (!parse_sprite(entry, key, load_context.resource_manager, load_context.load_textures, blueprint.sprite)) {
+            success = false;
+            continue;
+        }
+        blueprint.name = entry.value("name", key);
+        blueprint.stats = parse_stats(entry);
+        blueprint.speed = entry.value("speed", 0.f);
+        blueprint.ranged = entry.value("ranged", false);
+        blueprint.projectile_id = parse_projectile(entry);
+        blueprint.clips = parse_clips(entry, blueprint.sprite);
+        blueprint.sounds = parse_sounds(entry, load_context.sound_paths);
+        insert_blueprint(enemies_, enemy_index_, std::move(blueprint));
+    }
+    return success;
+}
+
+bool BlueprintRegistry::load_players(const nlohmann::json& json, LoadContext& load_context) {
+    bool success = true;
+    for (const auto& [key, entry] : json.items()) {
+        PlayerBlueprint blueprint;
+        blueprint.id = to_id(key);
+        blueprint.key = key;
+        if (!parse_sprite(entry, key, load_context.resource_manager, load_context.load_textures, blueprint.sprite)) {
+            success = false;
+            continue;
+        }
+        blueprint.name = entry.value("name", key);
+        blueprint.description = entry.value("description", "");
+        blueprint.stats = parse_stats(entry);
+        blueprint.type = entry.value("type", "melee") == "ranged" ? UnitType::Ranged : UnitType::Melee;
+        blueprint.healer = entry.value("healer", false);
+        blueprint.block = entry.value("block", 0);
+        blueprint.cost = entry.value("cost", 0);
+        blueprint.skill = entry.value("skill", "");
+        blueprint.projectile_id = parse_projectile(entry);
+        blueprint.clips = parse_clips(entry, blueprint.sprite);
+        blueprint.sounds = parse_sounds(entry, load_context.sound_paths);
+        insert_blueprint(players_, player_index_, std::move(blueprint));
+    }
+    return success;
+}
+
+bool BlueprintRegistry::load_projectiles(const nlohmann::json& json, LoadContext& load_context) {
+    bool success = true;
+    for (const auto& [key, entry] : json.items()) {
+        ProjectileBlueprint blueprint;
+        blueprint.id = to_id(key);
+        blueprint.key = key;
+        if (!parse_sprite(entry, key, load_context.resource_manager, load_context.load_textures, blueprint.sprite)) {
+            success = false;
+            continue;
+        }
+        blueprint.arc_height = entry.value("arc_height", 0.f);
+        blueprint.total_flight_time = sf::seconds(entry.value("total_flight_time", 0.f));
+        blueprint.sounds = parse_sounds(entry, load_context.sound_paths);
+        insert_blueprint(projectiles_, projectile_index_, std::move(blueprint));
+    }
+    return success;
+}
+
+bool BlueprintRegistry::load_effects(const nlohmann::json& json, LoadContext& load_context) {
+    bool success = true;
+    for (const auto& [key, entry] : json.items()) {
+        EffectBlueprint blueprint;
+        blueprint.id = to_id(key);
+        blueprint.key = key;
+        if (!parse_sprite(entry, key, load_context.resource_manager, load_context.load_textures, blueprint.sprite)) {
+            success = false;
+            continue;
+        }
+        // 特效只有一个动画片段，名称与键名相同；多帧的特效播放一次，单帧的是常驻标记
+        if (entry.contains("animation")) {
+            const auto& clip_json = entry["animation"];
+            const bool is_static = clip_json.contains("frames") && clip_json["frames"].size() <= 1;
+            if (auto clip = parse_clip(clip_json, key, blueprint.sprite, is_static); clip) {
+                blueprint.clip = std::move(*clip);
+                if (!blueprint.clip.animation->is_empty()) {
+                    blueprint.sprite.source_rect = blueprint.clip.animation->get_frames().front().source_rect;
+                }
+            }
+        }
+        insert_blueprint(effects_, effect_index_, std::move(blueprint));
+    }
+    return success;
+}
+
+const EnemyBlueprint* BlueprintRegistry::find_enemy(entt::id_type id) const { return find_in(enemies_, enemy_index_, id); }
+const EnemyBlueprint* BlueprintRegistry::find_enemy(std::string_view key) const { return find_enemy(to_id(key)); }
+const PlayerBlueprint* BlueprintRegistry::find_player(entt::id_type id) const { return find_in(players_, player_index_, id); }
+const PlayerBlueprint* BlueprintRegistry::find_player(std::string_view key) const { return find_player(to_id(key)); }
+const ProjectileBlueprint* BlueprintRegistry::find_projectile(entt::id_type id) const { return find_in(projectiles_, projectile_index_, id); }
+const ProjectileBlueprint* BlueprintRegistry::find_projectile(std::string_view key) const { return find_projectile(to_id(key)); }
+const EffectBlueprint* BlueprintRegistry::find_effect(entt::id_type id) const { return find_in(effects_, effect_index_, id); }
+const EffectBlueprint* BlueprintRegistry::find_effect(std::string_view key) const { return find_effect(to_id(key)); }
+
+std::unique_ptr<engine::object::GameObject> BlueprintRegistry::spawn(engine::scene::Scene& scene, const EnemyBlueprint& blueprint, sf::Vector2f position) {
+    auto object = scene.create_game_object(blueprint.key, ENEMY_TAG);
+    add_display(*object, blueprint.sprite, position);
+    add_clips(*object, blueprint.clips, ENEMY_INITIAL_ANIMATION);
+    // 塔防中单位受击不需要无敌帧
+    object->add_component<engine::component::HealthComponent>(blueprint.stats.hp, sf::Time::Zero);
+    add_sounds(*object, blueprint.sounds, scene.get_context());
+    add_spatial(*object);
+    return object;
+}
+
+std::unique_ptr<engine::object::GameObject> BlueprintRegistry::spawn(engine::scene::Scene& scene, const PlayerBlueprint& blueprint, sf::Vector2f position) {
+    auto object = scene.create_game_object(blueprint.key, PLAYER_TAG);
+    add_display(*object, blueprint.sprite, position);
+    add_clips(*object, blueprint.clips, PLAYER_INITIAL_ANIMATION);
+    object->add_component<engine::component::HealthComponent>(blueprint.stats.hp, sf::Time::Zero);
+    add_sounds(*object, blueprint.sounds, scene.get_context());
+    add_spatial(*object);
+    return object;
+}
+
+std::unique_ptr<engine::object::GameObject> BlueprintRegistry::spawn(engine::scene::Scene& scene, const ProjectileBlueprint& blueprint, sf::Vector2f position) {
+    auto object = scene.create_game_object(blueprint.key, PROJECTILE_TAG);
+    add_display(*object, blueprint.sprite, position, engine::render::RenderLayer::Effect);
+    add_sounds(*object, blueprint.sounds, scene.get_context());
+    return object;
+}
+
+std::unique_ptr<engine::object::GameObject> BlueprintRegistry::spawn(engine::scene::Scene& scene, const EffectBlueprint& blueprint, sf::Vector2f position) {
+    auto object = scene.create_game_object(blueprint.key, EFFECT_TAG);
+    add_display(*object, blueprint.sprite, position, engine::render::RenderLayer::Effect);
+    if (blueprint.clip.animation) {
+        auto* animation = object->add_component<engine::component::AnimationComponent>();
+        animation->add_animation(blueprint.clip.animation);
+        animation->set_one_shot_removal(!blueprint.clip.animation->is_looping());
+        animation->play_animation(blueprint.key);
+    }
+    return object;
+}
+
+void BlueprintRegistry::restore(engine::object::GameObject& object, const EnemyBlueprint& blueprint) { restore_identity(object, blueprint.key, ENEMY_TAG); }
+void BlueprintRegistry::restore(engine::object::GameObject& object, const PlayerBlueprint& blueprint) { restore_identity(object, blueprint.key, PLAYER_TAG); }
+void BlueprintRegistry::restore(engine::object::GameObject& object, const ProjectileBlueprint& blueprint) { restore_identity(object, blueprint.key, PROJECTILE_TAG); }
+void BlueprintRegistry::restore(engine::object::GameObject& object, const EffectBlueprint& blueprint) { restore_identity(object, blueprint.key, EFFECT_TAG); }
+} // namespace game::data
@@ -1,4 +1,5 @@
 #include "game/scene/game_scene.hpp"
+#include "game/data/blueprint_pools.hpp"
 #include "engine/input/input_manager.hpp"
 #include "engine/core/context.hpp"
 #include "engine/utils/events.hpp"
@@ -7,11 +8,18 @@
 #include <spdlog/spdlog.h>
 
 namespace game::scene {
-GameScene::GameScene(engine::core::Context& context)
-    : Scene{"GameScene", context} {
+GameScene::GameScene(engine::core::Context& context, const game::data::BlueprintRegistry& blueprints, std::size_t level_index)
+    : Scene{"GameScene", context}
+    , blueprints_{blueprints}
+    , pools_{std::make_unique<game::data::BlueprintPools>(*this, blueprints)}
+    , level_index_{level_index} {
     static int count = 0;
     scene_index_ = count++;
-    spdlog::info("场景编号：{}", scene_index_);
+    spdlog::info("场景编号：{}，关卡 {}", scene_index_, level_index_);
+
+    // 按本关卡的波次规模预热对象池，战斗中生成敌人、投射物和特效时不再分配；
+    // 对象在之后的更新中分批创建（见 update），构造（切换场景）时不一次性创建所有对象
+    pools_->plan_warm_up(level_index_);
     
     // 注册输入回调事件 (J,K 键)
     auto& input_manager = context_.get_input_manager();
@@ -28,16 +36,22 @@ GameScene::~GameScene() {
     input_manager.on_action(Action::MouseLeft).disconnect<&GameScene::on_push>(this);  // 鼠标左键
     input_manager.on_action(Action::MouseRight).disconnect<&GameScene::on_pop>(this);  // 鼠标右键
     input_manager.on_action(Action::Pause).disconnect<&GameScene::on_quit>(this);       // P 键
+    pools_->log_stats();
+}
+
+void GameScene::update(sf::Time delta) {
+    if (pools_->is_warming_up()) pools_->warm_up_step(WARM_UP_OBJECTS_PER_UPDATE);
+    Scene::update(delta);
 }
 
 void GameScene::on_replace() {
     spdlog::info("on_replace, 切换场景");
-    request_replace_scene(std::make_unique<game::scene::GameScene>(context_));
+    request_replace_scene(std::make_unique<game::scene::GameScene>(context_, blueprints_, level_index_));
 }
 
 void GameScene::on_push() {
     spdlog::info("on_push, 压入场景");
-    request_push_scene(std::make_unique<game::scene::GameScene>(context_));
+    request_push_scene(std::make_unique<game::scene::GameScene>(context_, blueprints_, level_index_));
 }
 
 void GameScene::on_pop() {
@@ -1,18 +1,94 @@
 #include "engine/core/game.hpp"
 #include "engine/core/context.hpp"
+#include "engine/render/render.hpp"
 #include "engine/utils/events.hpp"
+#include "game/data/blueprint_registry.hpp"
 #include "game/scene/game_scene.hpp"
 #include "entt/signal/dispatcher.hpp"
 #include <spdlog/spdlog.h>
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <string>
+#include <system_error>
 
-int main(int, char*[]) {
+namespace {
+void print_usage(std::string_view program) {
+    spdlog::info("用法: {} [--headless [ticks]] [--record <file>] [--replay <file>]\n"
+                 "  --headless [ticks] 以无头模式运行 ticks 次固定步长更新（正整数，默认 10000，回放时默认到录制结束）\n"
+                 "  --record <file>    录制输入\n"
+                 "  --replay <file>    回放录制的输入（回放结束后退出）", program);
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
     spdlog::set_level(spdlog::level::info);
-    
-    engine::core::Game game;
-    game.register_scene_setup([](engine::core::Context& context) {
+
+    // 命令行参数：
+    //   --headless [ticks] 以无头模式运行指定次数的固定步长更新（默认 10000，回放时默认到录制结束）
+    //   --record <file>    录制输入
+    //   --replay <file>    回放录制的输入（回放结束后退出）
+    bool headless = false;
+    std::optional<std::uint64_t> headless_ticks;
+    std::string record_path;
+    std::string replay_path;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg(argv[i]);
+        if (arg == "--record" && i + 1 < argc) {
+            record_path = argv[++i];
+        } else if (arg == "--replay" && i + 1 < argc) {
+            replay_path = argv[++i];
+        } else if (arg == "--headless") {
+            headless = true;
+            // 下一个参数是其他选项时使用默认次数，否则必须是正整数（from_chars 不接受负号，"-5" 不会回绕成极大的次数）
+            if (i + 1 < argc && !std::string_view(argv[i + 1]).starts_with("--")) {
+                const std::string_view value(argv[++i]);
+                std::uint64_t ticks = 0;
+                const auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), ticks);
+                if (ec != std::errc{} || end != value.data() + value.size() || ticks == 0) {
+                    spdlog::error("--headless 的更新次数必须是正整数，收到 '{}'", value);
+                    print_usage(argv[0]);
+                    return 1;
+                }
+                headless_ticks = ticks;
+            }
+        }
+    }
+
+    // 蓝图声明在 game 之前，保证所有场景销毁后才析构
+    game::data::BlueprintRegistry blueprints;
+    bool blueprints_loaded = true;
+    engine::core::Game game(headless);
+    game.register_scene_setup([&blueprints, &blueprints_loaded](engine::core::Context& context) {
+        // 启动时一次性解析所有对象数据，之后生成对象不再读取 JSON
+        // 无头模式没有渲染目标，不加载纹理（创建纹理需要 GL 上下文，无显示器的环境中会直接终止进程）
+        const bool load_textures = !context.get_renderer().is_headless();
+        if (!blueprints.load(context.get_resource_manager(), game::data::BlueprintRegistry::DEFAULT_DATA_DIR, load_textures)) {
+            spdlog::error("对象数据加载失败（见上面的错误），游戏退出");
+            blueprints_loaded = false;
+            context.get_dispatcher().trigger<engine::utils::QuitEvent>();
+            return;
+        }
         // GameApp在调用run方法之前，先创建并设置初始场景
-        auto game_scene = std::make_unique<game::scene::GameScene>(context);
+        auto game_scene = std::make_unique<game::scene::GameScene>(context, blueprints);
         context.get_dispatcher().trigger<engine::utils::PushSceneEvent>(engine::utils::PushSceneEvent{std::move(game_scene)});
     });
-    game.run();
-}
\ No newline at end of file
+
+    if (!replay_path.empty() && !game.start_replay(replay_path)) {
+        return 1;
+    }
+    if (!record_path.empty()) {
+        game.start_recording(record_path);
+    }
+
+    if (headless) {
+        // 回放时默认运行到录制结束
+        const std::uint64_t default_ticks = replay_path.empty() ? 10000 : std::numeric_limits<std::uint64_t>::max();
+        game.run_headless(headless_ticks.value_or(default_ticks));
+    } else {
+        game.run();
+    }
+    return blueprints_loaded ? 0 : 1;
+}